@@ -0,0 +1,253 @@
+/*
+ * Author: Martin Nguyen
+ * Description: Implementation of the CorpusReader class for Minesweeper game
+ * Date: 10/19/2026
+ */
+
+#include "CorpusReader.h"
+#include "CorpusWriter.h"
+
+// System/standard libraries
+#include <algorithm>
+#include <filesystem>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+
+// Little-endian helpers for the file format
+std::uint32_t readU32(const std::uint8_t *p)
+{
+    return static_cast<std::uint32_t>(p[0]) | (static_cast<std::uint32_t>(p[1]) << 8) |
+           (static_cast<std::uint32_t>(p[2]) << 16) | (static_cast<std::uint32_t>(p[3]) << 24);
+}
+
+std::uint64_t readU64(const std::uint8_t *p)
+{
+    return readU32(p) | (static_cast<std::uint64_t>(readU32(p + 4)) << 32);
+}
+
+} // namespace
+
+/*
+ * Constructor: CorpusReader
+ * Description: Creates a reader with no corpus open
+ */
+CorpusReader::CorpusReader() : boards(0)
+{
+}
+
+/*
+ * Destructor: CorpusReader
+ * Description: Unmaps the segments
+ */
+CorpusReader::~CorpusReader()
+{
+    close();
+}
+
+/*
+ * Function: open
+ * Description: Maps every finished segment in a corpus directory
+ * Parameters: directory - The corpus
+ * Returns: true on success, false if the directory can't be read
+ */
+bool CorpusReader::open(const std::string &directory)
+{
+    close();
+    std::error_code error;
+    std::filesystem::directory_iterator entries(directory, error);
+    if (error)
+        return false;
+    for (const std::filesystem::directory_entry &entry : entries)
+    {
+        if (entry.path().extension() == CorpusWriter::EXTENSION)
+            mapSegment(entry.path().string());
+    }
+    std::sort(segments.begin(), segments.end(),
+              [](const Segment &a, const Segment &b) { return a.info.firstId < b.info.firstId; });
+    return true;
+}
+
+/*
+ * Function: close
+ * Description: Unmaps the segments
+ */
+void CorpusReader::close()
+{
+    for (const Segment &segment : segments)
+        munmap(const_cast<std::uint8_t *>(segment.data), segment.size);
+    segments.clear();
+    codecs.clear();
+    boards = 0;
+}
+
+/*
+ * Function: getBoardCount
+ * Description: Gets the number of boards in the corpus
+ * Returns: Board count
+ */
+std::uint64_t CorpusReader::getBoardCount() const
+{
+    return boards;
+}
+
+/*
+ * Function: getSegmentCount
+ * Description: Gets the number of segments in the corpus
+ * Returns: Segment count
+ */
+size_t CorpusReader::getSegmentCount() const
+{
+    return segments.size();
+}
+
+/*
+ * Function: getSegmentInfo
+ * Description: Gets the board size, id range and checksum of a segment (segments are in id order)
+ * Parameters: segment - The segment (below getSegmentCount())
+ * Returns: A reference to the segment's details
+ */
+const CorpusReader::SegmentInfo &CorpusReader::getSegmentInfo(size_t segment) const
+{
+    return segments[segment].info;
+}
+
+/*
+ * Function: getLayout
+ * Description: Gets the mine layout of a board
+ * Parameters: id - Board id, layout - Set to the mine cells (sorted),
+ *             hash - Set to the record's LayoutCodec::hashRecord if not null
+ * Returns: true on success, false if there is no such board or its record is damaged
+ */
+bool CorpusReader::getLayout(std::uint64_t id, std::vector<int> &layout, std::uint64_t *hash) const
+{
+    const Segment *segment = findSegment(id);
+    return segment != nullptr && getLayout(*segment, id, layout, hash);
+}
+
+/*
+ * Function: loadInto
+ * Description: Starts a game on a board from the corpus
+ * Parameters: id - Board id, engine - The engine to load it into
+ * Returns: true on success, false if there is no such board or its record is damaged
+ */
+bool CorpusReader::loadInto(std::uint64_t id, GameEngine &engine) const
+{
+    const Segment *segment = findSegment(id);
+    // Decoding reuses one buffer per thread, so loading allocates nothing once warmed up
+    thread_local std::vector<int> layout;
+    return segment != nullptr && getLayout(*segment, id, layout) &&
+           engine.loadLayout(segment->info.width, segment->info.height, layout);
+}
+
+/*
+ * Function: getLayout
+ * Description: Gets the mine layout of a board in a known segment
+ * Parameters: segment - The segment holding the board, id - Board id, layout - Set to the mine
+ *             cells (sorted), hash - Set to the record's LayoutCodec::hashRecord if not null
+ * Returns: true on success, false if the board's record is damaged
+ */
+bool CorpusReader::getLayout(const Segment &segment, std::uint64_t id, std::vector<int> &layout,
+                             std::uint64_t *hash) const
+{
+    // Index entry for the group the board is in, then skip to it within the group
+    std::uint64_t local = id - segment.info.firstId;
+    std::uint64_t offset = readU64(segment.recordsEnd + local / segment.indexStride * 8);
+    if (offset < CorpusWriter::HEADER_SIZE || offset >= static_cast<std::uint64_t>(segment.recordsEnd - segment.data))
+        return false;
+    const std::uint8_t *record = segment.data + offset;
+    for (std::uint64_t i = local % segment.indexStride; i > 0 && record != nullptr; --i)
+        record = segment.codec->skip(record, segment.recordsEnd);
+    if (record == nullptr)
+        return false;
+
+    if (hash != nullptr)
+    {
+        const std::uint8_t *next = segment.codec->skip(record, segment.recordsEnd);
+        if (next == nullptr)
+            return false;
+        *hash = LayoutCodec::hashRecord(id, record, static_cast<size_t>(next - record));
+    }
+    return segment.codec->decode(record, segment.recordsEnd, layout);
+}
+
+/*
+ * Function: findSegment
+ * Description: Finds the segment holding a board
+ * Parameters: id - Board id
+ * Returns: The segment, or nullptr if no segment holds that id
+ */
+const CorpusReader::Segment *CorpusReader::findSegment(std::uint64_t id) const
+{
+    auto after = std::upper_bound(segments.begin(), segments.end(), id,
+                                  [](std::uint64_t value, const Segment &segment) { return value < segment.info.firstId; });
+    if (after == segments.begin())
+        return nullptr;
+    const Segment &segment = *(after - 1);
+    return id - segment.info.firstId < segment.info.count ? &segment : nullptr;
+}
+
+/*
+ * Function: mapSegment
+ * Description: Maps one segment file and checks its header and index fit in it. Unfinished
+ *              or damaged segments are skipped.
+ * Parameters: path - The segment file
+ * Returns: true if the segment was added
+ */
+bool CorpusReader::mapSegment(const std::string &path)
+{
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+        return false;
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size < CorpusWriter::HEADER_SIZE)
+    {
+        ::close(fd);
+        return false;
+    }
+    size_t size = static_cast<size_t>(info.st_size);
+    void *mapping = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd); // the mapping keeps the file alive
+    if (mapping == MAP_FAILED)
+        return false;
+
+    Segment segment;
+    segment.data = static_cast<const std::uint8_t *>(mapping);
+    segment.size = size;
+    const std::uint8_t *header = segment.data;
+    segment.info.width = header[8] | (header[9] << 8);
+    segment.info.height = header[10] | (header[11] << 8);
+    segment.info.mines = static_cast<int>(readU32(header + 12));
+    segment.info.firstId = readU64(header + 16);
+    segment.info.count = readU64(header + 24);
+    segment.info.checksum = readU64(header + 40);
+    segment.indexStride = readU32(header + 48);
+    std::uint64_t indexOffset = readU64(header + 32);
+    std::uint64_t indexEntries = segment.indexStride == 0 ? 0 : (segment.info.count + segment.indexStride - 1) / segment.indexStride;
+    std::int64_t cells = static_cast<std::int64_t>(segment.info.width) * segment.info.height;
+
+    bool valid = readU32(header) == CorpusWriter::SEGMENT_MAGIC && readU32(header + 4) == CorpusWriter::VERSION &&
+                 indexOffset >= CorpusWriter::HEADER_SIZE && segment.indexStride != 0 &&
+                 indexOffset <= size && (size - indexOffset) / 8 >= indexEntries &&
+                 cells > 0 && cells <= GameEngine::MAX_CELLS && segment.info.mines >= 0 && segment.info.mines <= cells;
+    if (!valid)
+    {
+        munmap(mapping, size);
+        return false;
+    }
+    segment.recordsEnd = segment.data + indexOffset;
+
+    // Segments of the same board size share one codec (and its binomial table)
+    std::pair<int, int> key(static_cast<int>(cells), segment.info.mines);
+    std::shared_ptr<const LayoutCodec> &codec = codecs[key];
+    if (!codec)
+        codec = std::make_shared<const LayoutCodec>(key.first, key.second);
+    segment.codec = codec;
+
+    segments.push_back(segment);
+    boards += segment.info.count;
+    return true;
+}
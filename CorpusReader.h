@@ -0,0 +1,77 @@
+/*
+ * Author: Martin Nguyen
+ * Description: CorpusReader class, random access to the boards of a corpus (POSIX, uses mmap)
+ * Date: 10/19/2026
+ *
+ * Opening a corpus maps every finished segment and reads only the headers. Looking up
+ * a board finds its segment by id, reads one index entry and skips a few records, so
+ * it costs the same however big the corpus is. Lookups only read the mapping and can
+ * run on many threads at once.
+ */
+
+#ifndef CORPUSREADER_H
+#define CORPUSREADER_H
+
+// System/standard libraries
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "GameEngine.h"
+#include "LayoutCodec.h"
+
+class CorpusReader {
+public:
+    // What a segment holds
+    struct SegmentInfo {
+        int width;
+        int height;
+        int mines;
+        std::uint64_t firstId;
+        std::uint64_t count;
+        std::uint64_t checksum;
+    };
+
+    // Constructor and destructor
+    CorpusReader();
+    virtual ~CorpusReader();
+
+    // Opening and closing
+    bool open(const std::string &directory);
+    void close();
+
+    // Corpus contents
+    std::uint64_t getBoardCount() const;
+    size_t getSegmentCount() const;
+    const SegmentInfo& getSegmentInfo(size_t segment) const;
+
+    // Boards by id
+    bool getLayout(std::uint64_t id, std::vector<int> &layout, std::uint64_t *hash = nullptr) const;
+    bool loadInto(std::uint64_t id, GameEngine &engine) const;
+
+private:
+    // One mapped segment file
+    struct Segment {
+        SegmentInfo info;
+        const std::uint8_t *data;
+        size_t size;
+        const std::uint8_t *recordsEnd; // the index starts here
+        std::uint32_t indexStride;
+        std::shared_ptr<const LayoutCodec> codec;
+    };
+
+    // Instance variables
+    std::vector<Segment> segments; // sorted by first id
+    std::map<std::pair<int, int>, std::shared_ptr<const LayoutCodec>> codecs; // by (cells, mines)
+    std::uint64_t boards;
+
+    // Private functions
+    const Segment* findSegment(std::uint64_t id) const;
+    bool getLayout(const Segment &segment, std::uint64_t id, std::vector<int> &layout, std::uint64_t *hash = nullptr) const;
+    bool mapSegment(const std::string &path);
+};
+
+#endif // CORPUSREADER_H
@@ -0,0 +1,242 @@
+/*
+ * Author: Martin Nguyen
+ * Description: Implementation of the CorpusWriter class for Minesweeper game
+ * Date: 10/19/2026
+ */
+
+#include "CorpusWriter.h"
+
+// System/standard libraries
+#include <algorithm>
+#include <filesystem>
+
+namespace {
+
+// Little-endian helpers for the file format
+void storeU32(std::uint8_t *p, std::uint32_t value)
+{
+    for (int i = 0; i < 4; ++i)
+        p[i] = static_cast<std::uint8_t>(value >> (8 * i));
+}
+
+void storeU64(std::uint8_t *p, std::uint64_t value)
+{
+    for (int i = 0; i < 8; ++i)
+        p[i] = static_cast<std::uint8_t>(value >> (8 * i));
+}
+
+std::uint32_t readU32(const std::uint8_t *p)
+{
+    return static_cast<std::uint32_t>(p[0]) | (static_cast<std::uint32_t>(p[1]) << 8) |
+           (static_cast<std::uint32_t>(p[2]) << 16) | (static_cast<std::uint32_t>(p[3]) << 24);
+}
+
+std::uint64_t readU64(const std::uint8_t *p)
+{
+    return readU32(p) | (static_cast<std::uint64_t>(readU32(p + 4)) << 32);
+}
+
+} // namespace
+
+/*
+ * Constructor: CorpusWriter
+ * Description: Creates a writer with no segment open
+ */
+CorpusWriter::CorpusWriter()
+    : width(0), height(0), indexStride(DEFAULT_INDEX_STRIDE), firstId(0), count(0), offset(0), checksum(0)
+{
+}
+
+/*
+ * Destructor: CorpusWriter
+ * Description: Finishes the open segment, if any
+ */
+CorpusWriter::~CorpusWriter()
+{
+    close();
+}
+
+/*
+ * Function: open
+ * Description: Starts a new segment in a corpus directory (created if needed). Its first id
+ *              follows the last board of the finished segments already there.
+ * Parameters: directory - The corpus, width - Number of columns, height - Number of rows,
+ *             mines - Mines on every board, indexStride - Boards per index entry
+ * Returns: true on success, false if the segment file can't be created
+ */
+bool CorpusWriter::open(const std::string &directory, int width, int height, int mines, std::uint32_t indexStride)
+{
+    close();
+    if (width <= 0 || height <= 0 || width > 0xFFFF || height > 0xFFFF ||
+        static_cast<std::int64_t>(width) * height > GameEngine::MAX_CELLS ||
+        mines < 0 || mines > width * height)
+        return false;
+    std::error_code error;
+    std::filesystem::create_directories(directory, error);
+
+    // Ids carry on after the highest finished segment
+    firstId = 0;
+    for (const std::filesystem::directory_entry &entry : std::filesystem::directory_iterator(directory, error))
+    {
+        if (entry.path().extension() != EXTENSION)
+            continue;
+        std::ifstream in(entry.path(), std::ios::binary);
+        std::uint8_t header[HEADER_SIZE];
+        if (in.read(reinterpret_cast<char *>(header), sizeof(header)) && readU32(header) == SEGMENT_MAGIC &&
+            readU32(header + 4) == VERSION && readU64(header + 32) != 0)
+            firstId = std::max(firstId, readU64(header + 16) + readU64(header + 24));
+    }
+
+    std::string name = std::to_string(firstId);
+    name.insert(0, name.size() < 12 ? 12 - name.size() : 0, '0'); // so names sort in id order
+    name += "-" + std::to_string(width) + "x" + std::to_string(height) + "-" + std::to_string(mines) + EXTENSION;
+    file.open(std::filesystem::path(directory) / name, std::ios::in | std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!file)
+        return false;
+
+    // Header now, with no index yet; close fills in the rest
+    std::uint8_t header[HEADER_SIZE] = {};
+    storeU32(header, SEGMENT_MAGIC);
+    storeU32(header + 4, VERSION);
+    header[8] = static_cast<std::uint8_t>(width);
+    header[9] = static_cast<std::uint8_t>(width >> 8);
+    header[10] = static_cast<std::uint8_t>(height);
+    header[11] = static_cast<std::uint8_t>(height >> 8);
+    storeU32(header + 12, static_cast<std::uint32_t>(mines));
+    storeU64(header + 16, firstId);
+    file.write(reinterpret_cast<const char *>(header), sizeof(header));
+
+    codec = LayoutCodec(width * height, mines);
+    this->width = width;
+    this->height = height;
+    this->indexStride = std::max<std::uint32_t>(indexStride, 1);
+    count = 0;
+    offset = HEADER_SIZE;
+    checksum = 0;
+    index.clear();
+    return static_cast<bool>(file);
+}
+
+/*
+ * Function: close
+ * Description: Finishes the segment: writes the index, then fills in the header
+ * Returns: true if the whole segment was written
+ */
+bool CorpusWriter::close()
+{
+    if (!file.is_open())
+        return false;
+
+    std::vector<std::uint8_t> entries(index.size() * 8);
+    for (size_t i = 0; i < index.size(); ++i)
+        storeU64(&entries[i * 8], index[i]);
+    file.write(reinterpret_cast<const char *>(entries.data()), static_cast<std::streamsize>(entries.size()));
+
+    std::uint8_t fields[40] = {};
+    storeU64(fields, count);
+    storeU64(fields + 8, offset);
+    storeU64(fields + 16, checksum);
+    storeU32(fields + 24, indexStride);
+    file.seekp(24);
+    file.write(reinterpret_cast<const char *>(fields), sizeof(fields));
+    file.flush();
+    bool written = static_cast<bool>(file);
+    file.close();
+    return written;
+}
+
+/*
+ * Function: isOpen
+ * Description: Checks if a segment is open
+ * Returns: true if boards can be added
+ */
+bool CorpusWriter::isOpen() const
+{
+    return file.is_open();
+}
+
+/*
+ * Function: add
+ * Description: Encodes a layout and adds it as the next board
+ * Parameters: layout - The mine cells (as many as the segment's mine count)
+ * Returns: true on success, false if the layout doesn't fit the segment or can't be written
+ */
+bool CorpusWriter::add(const std::vector<int> &layout)
+{
+    if (static_cast<int>(layout.size()) != codec.getMines())
+        return false;
+    for (int cell : layout)
+    {
+        if (cell < 0 || cell >= codec.getCells())
+            return false;
+    }
+    scratch.clear();
+    codec.encode(layout, scratch);
+    return addEncoded(scratch.data(), scratch.size());
+}
+
+/*
+ * Function: addEncoded
+ * Description: Adds boards that are already encoded as records, back to back
+ * Parameters: records - The records, size - Their total length in bytes
+ * Returns: true on success, false (adding nothing) if the records don't parse or can't be written
+ */
+bool CorpusWriter::addEncoded(const std::uint8_t *records, size_t size)
+{
+    if (!file.is_open())
+        return false;
+
+    // Check the whole block parses before any of it is counted
+    const std::uint8_t *end = records + size;
+    size_t boards = 0;
+    for (const std::uint8_t *p = records; p != end; ++boards)
+    {
+        p = codec.skip(p, end);
+        if (p == nullptr)
+            return false;
+    }
+
+    const std::uint8_t *p = records;
+    for (size_t i = 0; i < boards; ++i)
+    {
+        const std::uint8_t *next = codec.skip(p, end);
+        if (count % indexStride == 0)
+            index.push_back(offset + static_cast<std::uint64_t>(p - records));
+        checksum += LayoutCodec::hashRecord(firstId + count, p, static_cast<size_t>(next - p));
+        ++count;
+        p = next;
+    }
+    file.write(reinterpret_cast<const char *>(records), static_cast<std::streamsize>(size));
+    offset += size;
+    return static_cast<bool>(file);
+}
+
+/*
+ * Function: getCodec
+ * Description: Gets the codec for this segment's board size, for encoding records elsewhere
+ * Returns: The codec
+ */
+const LayoutCodec &CorpusWriter::getCodec() const
+{
+    return codec;
+}
+
+/*
+ * Function: getFirstId
+ * Description: Gets the id of the segment's first board
+ * Returns: The first id
+ */
+std::uint64_t CorpusWriter::getFirstId() const
+{
+    return firstId;
+}
+
+/*
+ * Function: getCount
+ * Description: Gets the number of boards added to the segment so far
+ * Returns: Board count
+ */
+std::uint64_t CorpusWriter::getCount() const
+{
+    return count;
+}
@@ -0,0 +1,81 @@
+/*
+ * Author: Martin Nguyen
+ * Description: CorpusWriter class, adds a segment of mine layouts to a board corpus
+ * Date: 10/19/2026
+ *
+ * A corpus is a directory of segment files. Every board in a segment has the same size
+ * and mine count, and boards are numbered across the corpus: a segment holds ids
+ * firstId to firstId + count - 1, and a new segment starts after the ones already there.
+ * Segments are written once and never changed, and one writer works on a corpus at a time.
+ *
+ * Segment layout (all integers little-endian):
+ *
+ *   header (HEADER_SIZE bytes): u32 SEGMENT_MAGIC, u32 VERSION, u16 width, u16 height,
+ *       u32 mines, u64 firstId, u64 count, u64 index offset, u64 checksum,
+ *       u32 index stride, u32 reserved, u64 reserved
+ *   records: one LayoutCodec record per board, in id order
+ *   index: one u64 file offset for every index-stride-th record
+ *
+ * Finding a board reads one index entry and skips fewer than index-stride records. The
+ * index offset stays 0 until the segment is finished, so a segment cut short by a crash
+ * is ignored. The checksum is the sum of LayoutCodec::hashRecord over the records.
+ */
+
+#ifndef CORPUSWRITER_H
+#define CORPUSWRITER_H
+
+// System/standard libraries
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "GameEngine.h"
+#include "LayoutCodec.h"
+
+class CorpusWriter {
+public:
+    // File format
+    static constexpr std::uint32_t SEGMENT_MAGIC = 0x5343534D; // "MSCS"
+    static constexpr std::uint32_t VERSION = 1;
+    static constexpr int HEADER_SIZE = 64;
+    static constexpr const char *EXTENSION = ".seg";
+
+    // One index entry per 32 boards
+    static constexpr std::uint32_t DEFAULT_INDEX_STRIDE = 32;
+
+    // Constructor and destructor
+    CorpusWriter();
+    virtual ~CorpusWriter();
+
+    // Starting and finishing a segment (boards up to GameEngine::MAX_CELLS cells)
+    bool open(const std::string &directory, int width, int height, int mines,
+              std::uint32_t indexStride = DEFAULT_INDEX_STRIDE);
+    bool close();
+    bool isOpen() const;
+
+    // Adding boards: a layout, or records already encoded with getCodec() (e.g. on other threads)
+    bool add(const std::vector<int> &layout);
+    bool addEncoded(const std::uint8_t *records, size_t size);
+
+    // Getters (public)
+    const LayoutCodec& getCodec() const;
+    std::uint64_t getFirstId() const;
+    std::uint64_t getCount() const;
+
+private:
+    // Instance variables
+    std::fstream file;
+    LayoutCodec codec;
+    int width;
+    int height;
+    std::uint32_t indexStride;
+    std::uint64_t firstId;
+    std::uint64_t count;
+    std::uint64_t offset; // where the next record goes
+    std::uint64_t checksum;
+    std::vector<std::uint64_t> index;
+    std::vector<std::uint8_t> scratch;
+};
+
+#endif // CORPUSWRITER_H
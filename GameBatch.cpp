@@ -0,0 +1,338 @@
+/*
+ * Author: Martin Nguyen
+ * Description: Implementation of the GameBatch class for Minesweeper game
+ * Date: 10/19/2026
+ */
+
+#include "GameBatch.h"
+
+// System/standard libraries
+#include <algorithm>
+
+// Lanes are padded to this many games so the cell row stride is a whole number of vector
+// registers (the vectors themselves only guarantee the usual heap alignment)
+static constexpr int LANE_ALIGN = 64;
+
+/*
+ * Constructor: GameBatch
+ * Description: Creates a batch of games that all share one board size
+ * Parameters: games - Number of games, width - Number of columns, height - Number of rows,
+ *             mines - Number of mines per game
+ */
+GameBatch::GameBatch(int games, int width, int height, int mines)
+    : games(games), width(width), height(height), mines(mines),
+      stride((games + LANE_ALIGN - 1) / LANE_ALIGN * LANE_ALIGN)
+{
+    size_t size = static_cast<size_t>(width) * height * stride;
+    mine.assign(size, 0);
+    adjacent.assign(size, 0);
+    revealed.assign(size, 0);
+    zero.assign(size, 0);
+    status.assign(stride, LOST); // padding lanes never play
+    revealedCount.assign(stride, 0);
+    scratch.assign(stride, 0);
+}
+
+/*
+ * Destructor: GameBatch
+ * Description: Destroys the batch object
+ */
+GameBatch::~GameBatch()
+{
+}
+
+/*
+ * Function: reset
+ * Description: Starts a new game in every lane. Lane g gets the same mines a GameEngine
+ *              seeded with seeds[g] would place, so batch and engine results can be compared.
+ * Parameters: seeds - One seed per game (extra seeds are ignored)
+ * Returns: true on success, false (leaving the batch as it was) if there are fewer seeds than games
+ */
+bool GameBatch::reset(const std::vector<std::uint32_t> &seeds)
+{
+    if (seeds.size() < static_cast<size_t>(games))
+        return false;
+
+    std::fill(mine.begin(), mine.end(), 0);
+    std::fill(revealed.begin(), revealed.end(), 0);
+    std::fill(status.begin(), status.end(), LOST);
+    std::fill(revealedCount.begin(), revealedCount.end(), 0);
+
+    // Mine placement is inherently per game, so it's the one scalar step
+    for (int g = 0; g < games; ++g)
+    {
+        for (int index : GameEngine::generateMineLayout(width * height, mines, seeds[g]))
+            mine[static_cast<size_t>(index) * stride + g] = 1;
+        status[g] = PLAYING;
+    }
+    calculateAdjacency();
+    return true;
+}
+
+/*
+ * Function: revealAll
+ * Description: Reveals the same cell in every game still playing. Lanes that hit a mine are lost;
+ *              the others flood fill together, one board sweep at a time, until nothing changes.
+ * Parameters: row - The row of the square, col - The column of the square
+ */
+void GameBatch::revealAll(int row, int col)
+{
+    if (row < 0 || row >= height || col < 0 || col >= width)
+        return;
+
+    const int lanes = stride;
+    size_t base = static_cast<size_t>(row * width + col) * stride;
+    std::uint8_t *rev = &revealed[base];
+    const std::uint8_t *isMineLane = &mine[base];
+    std::uint8_t *state = status.data();
+    for (int g = 0; g < lanes; ++g)
+    {
+        std::uint8_t open = (state[g] == PLAYING) & (rev[g] == 0);
+        rev[g] |= open;
+        state[g] = (open & isMineLane[g]) ? LOST : state[g];
+    }
+
+    // Alternate forward and backward sweeps over a dirty row range. A square can only open next
+    // to one that just opened, so each sweep covers the rows that changed in the last one plus
+    // one row either side, and grows in its own direction while the edge row keeps changing.
+    int lo = std::max(row - 1, 0);
+    int hi = std::min(row + 1, height - 1);
+    bool forward = true;
+    while (true)
+    {
+        int first = height;
+        int last = -1;
+        if (forward)
+        {
+            for (int r = lo; r <= hi; ++r)
+            {
+                bool changed = false;
+                for (int c = 0; c < width; ++c)
+                    changed |= propagate(r, c);
+                if (changed)
+                {
+                    first = std::min(first, r);
+                    last = r;
+                    if (r == hi && hi < height - 1)
+                        ++hi;
+                }
+            }
+        }
+        else
+        {
+            for (int r = hi; r >= lo; --r)
+            {
+                bool changed = false;
+                for (int c = width - 1; c >= 0; --c)
+                    changed |= propagate(r, c);
+                if (changed)
+                {
+                    first = r;
+                    last = std::max(last, r);
+                    if (r == lo && lo > 0)
+                        --lo;
+                }
+            }
+        }
+        if (last < 0)
+            break;
+        lo = std::max(first - 1, 0);
+        hi = std::min(last + 1, height - 1);
+        forward = !forward;
+    }
+}
+
+/*
+ * Function: checkWins
+ * Description: Counts revealed safe squares in every lane and marks the games where all are revealed
+ */
+void GameBatch::checkWins()
+{
+    const int lanes = stride;
+    std::uint32_t *count = revealedCount.data();
+    std::fill(revealedCount.begin(), revealedCount.end(), 0);
+    for (int cell = 0; cell < width * height; ++cell)
+    {
+        const std::uint8_t *rev = &revealed[static_cast<size_t>(cell) * stride];
+        const std::uint8_t *isMineLane = &mine[static_cast<size_t>(cell) * stride];
+        for (int g = 0; g < lanes; ++g)
+            count[g] += rev[g] & (isMineLane[g] ^ 1);
+    }
+
+    int cells = width * height;
+    std::uint32_t target = static_cast<std::uint32_t>(cells - (mines < cells ? mines : cells));
+    for (int g = 0; g < games; ++g)
+    {
+        if (status[g] == PLAYING && count[g] == target)
+            status[g] = WON;
+    }
+}
+
+/*
+ * Function: getGames
+ * Description: Gets the number of games in the batch
+ * Returns: Number of games
+ */
+int GameBatch::getGames() const
+{
+    return games;
+}
+
+/*
+ * Function: getWidth
+ * Description: Gets the number of columns on every board
+ * Returns: Board width
+ */
+int GameBatch::getWidth() const
+{
+    return width;
+}
+
+/*
+ * Function: getHeight
+ * Description: Gets the number of rows on every board
+ * Returns: Board height
+ */
+int GameBatch::getHeight() const
+{
+    return height;
+}
+
+/*
+ * Function: isMine
+ * Description: Checks if a square has a mine in one game
+ * Parameters: game - The game, row - The row of the square, col - The column of the square
+ * Returns: true if the square has a mine, false otherwise
+ */
+bool GameBatch::isMine(int game, int row, int col) const
+{
+    return mine[static_cast<size_t>(row * width + col) * stride + game] != 0;
+}
+
+/*
+ * Function: isRevealed
+ * Description: Checks if a square is revealed in one game
+ * Parameters: game - The game, row - The row of the square, col - The column of the square
+ * Returns: true if the square is revealed, false otherwise
+ */
+bool GameBatch::isRevealed(int game, int row, int col) const
+{
+    return revealed[static_cast<size_t>(row * width + col) * stride + game] != 0;
+}
+
+/*
+ * Function: getAdjacentMines
+ * Description: Gets the number of mines around a square in one game
+ * Parameters: game - The game, row - The row of the square, col - The column of the square
+ * Returns: Number of adjacent mines
+ */
+int GameBatch::getAdjacentMines(int game, int row, int col) const
+{
+    return adjacent[static_cast<size_t>(row * width + col) * stride + game];
+}
+
+/*
+ * Function: getRevealedCount
+ * Description: Gets the number of revealed safe squares in one game (as of the last checkWins)
+ * Parameters: game - The game
+ * Returns: Number of revealed safe squares
+ */
+int GameBatch::getRevealedCount(int game) const
+{
+    return static_cast<int>(revealedCount[game]);
+}
+
+/*
+ * Function: getStatus
+ * Description: Gets whether one game is still going, won or lost (as of the last checkWins)
+ * Parameters: game - The game
+ * Returns: The game status
+ */
+GameEngine::Status GameBatch::getStatus(int game) const
+{
+    if (status[game] == WON)
+        return GameEngine::Status::Won;
+    if (status[game] == LOST)
+        return GameEngine::Status::Lost;
+    return GameEngine::Status::Playing;
+}
+
+/*
+ * Function: calculateAdjacency
+ * Description: Calculates the number of adjacent mines for each square in every game at once
+ */
+void GameBatch::calculateAdjacency()
+{
+    const int lanes = stride;
+    for (int row = 0; row < height; ++row)
+    {
+        for (int col = 0; col < width; ++col)
+        {
+            size_t base = static_cast<size_t>(row * width + col) * stride;
+            std::uint8_t *count = &adjacent[base];
+            std::fill(count, count + lanes, 0);
+
+            // Add up each neighbour's mine lane
+            for (int dr = -1; dr <= 1; ++dr)
+            {
+                for (int dc = -1; dc <= 1; ++dc)
+                {
+                    int r = row + dr;
+                    int c = col + dc;
+                    if ((dr == 0 && dc == 0) || r < 0 || r >= height || c < 0 || c >= width)
+                        continue;
+                    const std::uint8_t *neighbour = &mine[static_cast<size_t>(r * width + c) * stride];
+                    for (int g = 0; g < lanes; ++g)
+                        count[g] += neighbour[g];
+                }
+            }
+
+            const std::uint8_t *isMineLane = &mine[base];
+            std::uint8_t *isZero = &zero[base];
+            for (int g = 0; g < lanes; ++g)
+                isZero[g] = (count[g] == 0) & (isMineLane[g] ^ 1);
+        }
+    }
+}
+
+/*
+ * Function: propagate
+ * Description: Reveals a square in every playing game where a revealed neighbour has no adjacent mines
+ * Parameters: row - The row of the square, col - The column of the square
+ * Returns: true if any game changed
+ */
+bool GameBatch::propagate(int row, int col)
+{
+    const int lanes = stride;
+    std::uint8_t *open = scratch.data();
+    std::fill(open, open + lanes, 0);
+
+    for (int dr = -1; dr <= 1; ++dr)
+    {
+        for (int dc = -1; dc <= 1; ++dc)
+        {
+            int r = row + dr;
+            int c = col + dc;
+            if ((dr == 0 && dc == 0) || r < 0 || r >= height || c < 0 || c >= width)
+                continue;
+            size_t neighbour = static_cast<size_t>(r * width + c) * stride;
+            const std::uint8_t *rev = &revealed[neighbour];
+            const std::uint8_t *isZero = &zero[neighbour];
+            for (int g = 0; g < lanes; ++g)
+                open[g] |= rev[g] & isZero[g];
+        }
+    }
+
+    size_t base = static_cast<size_t>(row * width + col) * stride;
+    std::uint8_t *rev = &revealed[base];
+    const std::uint8_t *isMineLane = &mine[base];
+    const std::uint8_t *state = status.data();
+    std::uint8_t any = 0;
+    for (int g = 0; g < lanes; ++g)
+    {
+        std::uint8_t reveal = open[g] & (isMineLane[g] ^ 1) & (rev[g] ^ 1) & (state[g] == PLAYING);
+        rev[g] |= reveal;
+        any |= reveal;
+    }
+    return any != 0;
+}
@@ -0,0 +1,72 @@
+/*
+ * Author: Martin Nguyen
+ * Description: GameBatch class, many same-size games stepped together for Monte Carlo runs
+ * Date: 10/19/2026
+ *
+ * Cell state is stored structure-of-arrays with the game as the fastest index:
+ * value[cell * stride + game]. Every operation walks cells in the outer loop and games
+ * in the inner loop, so the inner loops are straight byte loops the compiler turns into
+ * SIMD lanes over games. Batches only model reveals (no flags or question marks).
+ *
+ * Every reveal costs at least one sweep of the rows around the square in every lane, even
+ * where only one cell opens, so the batch only beats separate GameEngine objects for large
+ * game counts (thousands); for a handful of games use GameEngine directly.
+ */
+
+#ifndef GAMEBATCH_H
+#define GAMEBATCH_H
+
+// System/standard libraries
+#include <vector>
+#include <cstdint>
+
+#include "GameEngine.h"
+
+class GameBatch {
+public:
+    // Constructor and destructor
+    GameBatch(int games, int width, int height, int mines);
+    virtual ~GameBatch();
+
+    // Public functions
+    bool reset(const std::vector<std::uint32_t> &seeds);
+    void revealAll(int row, int col);
+    void checkWins();
+
+    // Getters (public)
+    int getGames() const;
+    int getWidth() const;
+    int getHeight() const;
+    bool isMine(int game, int row, int col) const;
+    bool isRevealed(int game, int row, int col) const;
+    int getAdjacentMines(int game, int row, int col) const;
+    int getRevealedCount(int game) const;
+    GameEngine::Status getStatus(int game) const;
+
+private:
+    // Lane status values (kept as bytes so they can be used as SIMD masks)
+    static constexpr std::uint8_t PLAYING = 0;
+    static constexpr std::uint8_t WON = 1;
+    static constexpr std::uint8_t LOST = 2;
+
+    // Instance variables
+    int games;
+    int width;
+    int height;
+    int mines;
+    int stride; // games rounded up to a whole number of vector registers (read into a local before
+                // byte loops, since byte stores may alias members and block vectorisation)
+    std::vector<std::uint8_t> mine;     // 1 if the cell is a mine
+    std::vector<std::uint8_t> adjacent; // number of adjacent mines
+    std::vector<std::uint8_t> revealed; // 1 if the cell is revealed
+    std::vector<std::uint8_t> zero;     // 1 if the cell is safe with no adjacent mines (flood fill source)
+    std::vector<std::uint8_t> status;   // per game: PLAYING, WON or LOST
+    std::vector<std::uint32_t> revealedCount;
+    std::vector<std::uint8_t> scratch;
+
+    // Private functions
+    void calculateAdjacency();
+    bool propagate(int row, int col);
+};
+
+#endif // GAMEBATCH_H
@@ -0,0 +1,761 @@
+/*
+ * Author: Martin Nguyen
+ * Description: Implementation of the headless GameEngine class for Minesweeper game
+ * Date: 10/19/2026
+ */
+
+#include "GameEngine.h"
+
+// System/standard libraries
+#include <algorithm>
+
+namespace {
+
+/*
+ * Function: boundedRandom
+ * Description: Draws a uniform number below a bound with Lemire's multiply-and-reject method.
+ *              Unlike rng() % bound it has no bias toward small values, and unlike
+ *              std::uniform_int_distribution it gives the same numbers on every standard library.
+ * Parameters: rng - The generator, bound - Exclusive upper bound (above 0)
+ * Returns: A number in [0, bound)
+ */
+std::uint32_t boundedRandom(std::mt19937 &rng, std::uint32_t bound)
+{
+    std::uint64_t product = static_cast<std::uint64_t>(rng()) * bound;
+    std::uint32_t low = static_cast<std::uint32_t>(product);
+    if (low < bound)
+    {
+        std::uint32_t threshold = (0u - bound) % bound; // 2^32 mod bound
+        while (low < threshold)
+        {
+            product = static_cast<std::uint64_t>(rng()) * bound;
+            low = static_cast<std::uint32_t>(product);
+        }
+    }
+    return static_cast<std::uint32_t>(product >> 32);
+}
+
+} // namespace
+
+/*
+ * Constructor: GameEngine
+ * Description: Initializes a new engine with an empty board of the given size
+ * Parameters: width - Number of columns, height - Number of rows, mines - Number of mines
+ */
+GameEngine::GameEngine(int width, int height, int mines)
+    : width(width), height(height), mines(mines), seed(0), hiddenSafe(0), status(Status::Playing), firstClick(true), clicks(0)
+{
+    reset();
+}
+
+/*
+ * Destructor: GameEngine
+ * Description: Destroys the engine object
+ */
+GameEngine::~GameEngine()
+{
+}
+
+/*
+ * Function: reset
+ * Description: Starts a new game on the current board size. Mines are placed on the first reveal,
+ *              using a fresh random seed unless setSeed is called afterwards.
+ */
+void GameEngine::reset()
+{
+    board = PersistentBoard(width * height);
+    changedCells.clear();
+    undoStack.clear();
+    redoStack.clear();
+    whatIfs.clear();
+    hiddenSafe = 0;
+    status = Status::Playing;
+    firstClick = true;
+    clicks = 0;
+    // random_device is a system call on most platforms, so only use it to seed a generator once per thread
+    thread_local std::mt19937 seedSource(std::random_device{}());
+    seed = seedSource();
+}
+
+/*
+ * Function: reset
+ * Description: Starts a new game with a new board size
+ * Parameters: width - Number of columns, height - Number of rows, mines - Number of mines
+ */
+void GameEngine::reset(int newWidth, int newHeight, int newMines)
+{
+    width = newWidth;
+    height = newHeight;
+    mines = newMines;
+    reset();
+}
+
+/*
+ * Function: setSeed
+ * Description: Sets the seed used to place mines on the first reveal (for reproducible games)
+ * Parameters: newSeed - The random seed
+ */
+void GameEngine::setSeed(std::uint32_t newSeed)
+{
+    seed = newSeed;
+}
+
+/*
+ * Function: loadLayout
+ * Description: Starts a new game on a stored board (e.g. from a corpus) instead of a random one.
+ *              The mines go straight onto the board, so the first reveal doesn't place any.
+ * Parameters: width - Number of columns, height - Number of rows, layout - Distinct mine cells
+ * Returns: true on success, false (leaving the game as it was) if the board is bigger than
+ *          MAX_CELLS or a mine cell is off the board or repeated
+ */
+bool GameEngine::loadLayout(int newWidth, int newHeight, const std::vector<int> &layout)
+{
+    if (newWidth <= 0 || newHeight <= 0 || static_cast<std::int64_t>(newWidth) * newHeight > MAX_CELLS)
+        return false;
+    int cells = newWidth * newHeight;
+
+    // Work out the board in a flat buffer and build the chunks from it in one go,
+    // rather than editing mines and numbers into the shared blank board one by one
+    std::vector<Space> spaces(static_cast<size_t>(cells));
+    for (int index : layout)
+    {
+        if (index < 0 || index >= cells || spaces[index].getIsMine())
+            return false;
+        spaces[index].setMine(true);
+    }
+    for (int index : layout)
+    {
+        int row = index / newWidth;
+        int col = index % newWidth;
+        for (int r = std::max(row - 1, 0); r <= std::min(row + 1, newHeight - 1); ++r)
+        {
+            for (int c = std::max(col - 1, 0); c <= std::min(col + 1, newWidth - 1); ++c)
+            {
+                Space &space = spaces[r * newWidth + c];
+                if (!space.getIsMine())
+                    space.setAdjacentMines(space.getAdjacentMines() + 1);
+            }
+        }
+    }
+
+    reset(newWidth, newHeight, static_cast<int>(layout.size()));
+    seed = 0; // no seed made this board
+    firstClick = false;
+    board = PersistentBoard(spaces);
+    hiddenSafe = cells - static_cast<int>(layout.size());
+    return true;
+}
+
+/*
+ * Function: reveal
+ * Description: Reveals a space, flood filling from spaces with no adjacent mines.
+ *              Hitting a mine ends the game and reports every mine as changed.
+ * Parameters: row - The row of the square, col - The column of the square
+ * Returns: The number of cells changed by this move (see getChangedCells)
+ */
+int GameEngine::reveal(int row, int col)
+{
+    changedCells.clear();
+    if (status != Status::Playing || !isInside(row, col))
+        return 0;
+    if (board.get(row * width + col).getIsRevealed())
+        return 0;
+
+    Snapshot before = saveSnapshot();
+
+    // If first click, place mines and calculate adjacency
+    if (firstClick)
+    {
+        placeMines(generateMineLayout(width * height, mines, seed));
+        firstClick = false;
+    }
+
+    if (isMine(row, col))
+    {
+        revealMine(row, col);
+    }
+    else
+    {
+        floodReveal(row, col);
+        checkWin();
+    }
+    record(std::move(before));
+    return static_cast<int>(changedCells.size());
+}
+
+/*
+ * Function: chord
+ * Description: Reveals every unflagged neighbour of a revealed number once it has
+ *              as many flags around it as its number
+ * Parameters: row - The row of the square, col - The column of the square
+ * Returns: The number of cells changed by this move (see getChangedCells)
+ */
+int GameEngine::chord(int row, int col)
+{
+    changedCells.clear();
+    if (status != Status::Playing || !isInside(row, col))
+        return 0;
+    const Space &space = board.get(row * width + col);
+    int adjacentMines = space.getAdjacentMines();
+    if (!space.getIsRevealed() || adjacentMines == 0)
+        return 0;
+
+    int flags = 0;
+    for (int dr = -1; dr <= 1; ++dr)
+        for (int dc = -1; dc <= 1; ++dc)
+            if ((dr != 0 || dc != 0) && isInside(row + dr, col + dc) &&
+                board.get((row + dr) * width + col + dc).getIsFlagged())
+                ++flags;
+    if (flags != adjacentMines)
+        return 0;
+
+    Snapshot before = saveSnapshot();
+    for (int dr = -1; dr <= 1 && status == Status::Playing; ++dr)
+    {
+        for (int dc = -1; dc <= 1 && status == Status::Playing; ++dc)
+        {
+            int r = row + dr;
+            int c = col + dc;
+            if ((dr == 0 && dc == 0) || !isInside(r, c))
+                continue;
+            const Space &neighbour = board.get(r * width + c);
+            if (neighbour.getIsRevealed() || neighbour.getIsFlagged())
+                continue;
+            if (neighbour.getIsMine())
+                revealMine(r, c); // wrong flag somewhere: same outcome as clicking the mine
+            else
+                floodReveal(r, c);
+        }
+    }
+    if (status == Status::Playing)
+        checkWin();
+    record(std::move(before));
+    return static_cast<int>(changedCells.size());
+}
+
+/*
+ * Function: toggleFlag
+ * Description: Puts a flag on a square (or removes it)
+ * Parameters: row - The row of the square, col - The column of the square
+ */
+void GameEngine::toggleFlag(int row, int col)
+{
+    changedCells.clear();
+    if (status != Status::Playing || !isInside(row, col))
+        return;
+    if (board.get(row * width + col).getIsRevealed())
+        return; // can't flag revealed squares!
+
+    Snapshot before = saveSnapshot();
+    Space &space = board.edit(row * width + col);
+    space.setFlagged(!space.getIsFlagged());
+    changedCells.push_back(row * width + col);
+    record(std::move(before));
+}
+
+/*
+ * Function: toggleQuestion
+ * Description: Puts a question mark on a square (or removes it)
+ * Parameters: row - The row of the square, col - The column of the square
+ */
+void GameEngine::toggleQuestion(int row, int col)
+{
+    changedCells.clear();
+    if (status != Status::Playing || !isInside(row, col))
+        return;
+    if (board.get(row * width + col).getIsRevealed())
+        return; // can't question revealed squares!
+
+    Snapshot before = saveSnapshot();
+    Space &space = board.edit(row * width + col);
+    space.setIsQuestion(!space.getIsQuestion());
+    changedCells.push_back(row * width + col);
+    record(std::move(before));
+}
+
+/*
+ * Function: cycleMark
+ * Description: Cycles the mark on an unrevealed square: empty -> flag -> question -> empty
+ * Parameters: row - The row of the square, col - The column of the square
+ */
+void GameEngine::cycleMark(int row, int col)
+{
+    changedCells.clear();
+    if (status != Status::Playing || !isInside(row, col))
+        return;
+    if (board.get(row * width + col).getIsRevealed())
+        return;
+
+    Snapshot before = saveSnapshot();
+    Space &space = board.edit(row * width + col);
+    if (space.getIsFlagged())
+    {
+        space.setFlagged(false);
+        space.setIsQuestion(true);
+    }
+    else if (space.getIsQuestion())
+    {
+        space.setIsQuestion(false);
+    }
+    else
+    {
+        space.setFlagged(true);
+    }
+    changedCells.push_back(row * width + col);
+    record(std::move(before));
+}
+
+/*
+ * Function: undo
+ * Description: Takes back the last move (not past the start of an open what-if)
+ * Returns: true if a move was undone; getChangedCells lists the cells it touched
+ */
+bool GameEngine::undo()
+{
+    changedCells.clear();
+    if (!canUndo())
+        return false;
+    jump(undoStack, redoStack);
+    return true;
+}
+
+/*
+ * Function: redo
+ * Description: Plays back the last undone move
+ * Returns: true if a move was redone; getChangedCells lists the cells it touched
+ */
+bool GameEngine::redo()
+{
+    changedCells.clear();
+    if (!canRedo())
+        return false;
+    jump(redoStack, undoStack);
+    return true;
+}
+
+/*
+ * Function: canUndo
+ * Description: Checks if there is a move to undo
+ * Returns: true if undo would do something
+ */
+bool GameEngine::canUndo() const
+{
+    return !undoStack.empty() && (whatIfs.empty() || undoStack.size() > whatIfs.back().undoSize);
+}
+
+/*
+ * Function: canRedo
+ * Description: Checks if there is a move to redo
+ * Returns: true if redo would do something
+ */
+bool GameEngine::canRedo() const
+{
+    return !redoStack.empty();
+}
+
+/*
+ * Function: beginWhatIf
+ * Description: Opens a what-if branch. Moves made from here on can all be rolled back at once.
+ *              Branches nest.
+ */
+void GameEngine::beginWhatIf()
+{
+    changedCells.clear();
+    whatIfs.push_back(WhatIf { saveSnapshot(), undoStack.size(), std::move(redoStack) });
+    redoStack.clear();
+}
+
+/*
+ * Function: rollbackWhatIf
+ * Description: Closes the innermost what-if branch and puts the game back how it was when it opened
+ * Returns: true if a branch was open; getChangedCells lists every cell the branch touched
+ */
+bool GameEngine::rollbackWhatIf()
+{
+    changedCells.clear();
+    if (whatIfs.empty())
+        return false;
+
+    // Anything the branch changed is in its part of the undo stack or in its redo stack
+    WhatIf whatIf = std::move(whatIfs.back());
+    whatIfs.pop_back();
+    for (size_t i = whatIf.undoSize; i < undoStack.size(); ++i)
+        changedCells.insert(changedCells.end(), undoStack[i].changed.begin(), undoStack[i].changed.end());
+    for (const HistoryEntry &entry : redoStack)
+        changedCells.insert(changedCells.end(), entry.changed.begin(), entry.changed.end());
+    std::sort(changedCells.begin(), changedCells.end());
+    changedCells.erase(std::unique(changedCells.begin(), changedCells.end()), changedCells.end());
+
+    restoreSnapshot(whatIf.start);
+    undoStack.erase(undoStack.begin() + static_cast<std::ptrdiff_t>(whatIf.undoSize), undoStack.end());
+    redoStack = std::move(whatIf.redoStack);
+    return true;
+}
+
+/*
+ * Function: commitWhatIf
+ * Description: Closes the innermost what-if branch and keeps its moves (they stay undoable)
+ * Returns: true if a branch was open
+ */
+bool GameEngine::commitWhatIf()
+{
+    changedCells.clear();
+    if (whatIfs.empty())
+        return false;
+    whatIfs.pop_back();
+    return true;
+}
+
+/*
+ * Function: getWhatIfDepth
+ * Description: Gets how many what-if branches are open
+ * Returns: Number of open branches
+ */
+int GameEngine::getWhatIfDepth() const
+{
+    return static_cast<int>(whatIfs.size());
+}
+
+/*
+ * Function: saveSnapshot
+ * Description: Copies the current state. The board is shared, so this costs O(1) now and
+ *              memory later only for the chunks changed after it.
+ * Returns: The snapshot
+ */
+GameEngine::Snapshot GameEngine::saveSnapshot() const
+{
+    return Snapshot { board, hiddenSafe, status, firstClick, seed };
+}
+
+/*
+ * Function: getWidth
+ * Description: Gets the number of columns on the board
+ * Returns: Board width
+ */
+int GameEngine::getWidth() const
+{
+    return width;
+}
+
+/*
+ * Function: getHeight
+ * Description: Gets the number of rows on the board
+ * Returns: Board height
+ */
+int GameEngine::getHeight() const
+{
+    return height;
+}
+
+/*
+ * Function: getMines
+ * Description: Gets the number of mines on the board
+ * Returns: Mine count
+ */
+int GameEngine::getMines() const
+{
+    return mines;
+}
+
+/*
+ * Function: getSeed
+ * Description: Gets the seed used to place the mines of this game
+ * Returns: The random seed (0 for a board from loadLayout)
+ */
+std::uint32_t GameEngine::getSeed() const
+{
+    return seed;
+}
+
+/*
+ * Function: getStatus
+ * Description: Gets whether the game is still going, won or lost
+ * Returns: The game status
+ */
+GameEngine::Status GameEngine::getStatus() const
+{
+    return status;
+}
+
+/*
+ * Function: getClicks
+ * Description: Gets the number of moves this game that changed the board (reveals, chords and marks)
+ * Returns: Click count
+ */
+int GameEngine::getClicks() const
+{
+    return clicks;
+}
+
+/*
+ * Function: getThreeBV
+ * Description: Gets the board's 3BV: the fewest clicks that reveal every safe square without flags.
+ *              Each opening (connected area with no adjacent mines, plus its border) takes one click,
+ *              and each safe square not on an opening's border takes one more.
+ * Returns: The 3BV, or 0 before the mines are placed
+ */
+int GameEngine::getThreeBV() const
+{
+    if (firstClick)
+        return 0;
+
+    int cells = width * height;
+    std::vector<bool> covered(static_cast<size_t>(cells), false);
+    std::vector<int> stack;
+    int threeBV = 0;
+
+    // One click per opening; mark the opening and its border as covered
+    for (int start = 0; start < cells; ++start)
+    {
+        const Space &space = board.get(start);
+        if (covered[start] || space.getIsMine() || space.getAdjacentMines() != 0)
+            continue;
+        ++threeBV;
+        covered[start] = true;
+        stack.push_back(start);
+        while (!stack.empty())
+        {
+            int index = stack.back();
+            stack.pop_back();
+            if (board.get(index).getAdjacentMines() != 0)
+                continue; // border square: covered, but doesn't open further
+            int r = index / width;
+            int c = index % width;
+            for (int dr = -1; dr <= 1; ++dr)
+            {
+                for (int dc = -1; dc <= 1; ++dc)
+                {
+                    int neighbour = (r + dr) * width + c + dc;
+                    if ((dr == 0 && dc == 0) || !isInside(r + dr, c + dc) || covered[neighbour])
+                        continue;
+                    covered[neighbour] = true;
+                    stack.push_back(neighbour);
+                }
+            }
+        }
+    }
+
+    // Then one click for every other safe square
+    for (int index = 0; index < cells; ++index)
+    {
+        if (!covered[index] && !board.get(index).getIsMine())
+            ++threeBV;
+    }
+    return threeBV;
+}
+
+/*
+ * Function: isInside
+ * Description: Checks if a position is on the board
+ * Parameters: row - The row of the square, col - The column of the square
+ * Returns: true if the position is on the board, false otherwise
+ */
+bool GameEngine::isInside(int row, int col) const
+{
+    return row >= 0 && row < height && col >= 0 && col < width;
+}
+
+/*
+ * Function: isMine
+ * Description: Checks if a square has a mine
+ * Parameters: row - The row of the square, col - The column of the square
+ * Returns: true if the square has a mine, false otherwise
+ */
+bool GameEngine::isMine(int row, int col) const
+{
+    return board.get(row * width + col).getIsMine();
+}
+
+/*
+ * Function: getSpace
+ * Description: Gets a read-only reference to a space on the board
+ * Parameters: row - The row of the square, col - The column of the square
+ * Returns: A reference to the space at the given row and column
+ */
+const Space &GameEngine::getSpace(int row, int col) const
+{
+    return board.get(row * width + col);
+}
+
+/*
+ * Function: getChangedCells
+ * Description: Gets the cells (row * width + col) changed by the last move
+ * Returns: A reference to the list of changed cells
+ */
+const std::vector<int> &GameEngine::getChangedCells() const
+{
+    return changedCells;
+}
+
+/*
+ * Function: generateMineLayout
+ * Description: Picks distinct random mine positions from a seed
+ * Parameters: cells - Number of cells on the board, mines - Number of mines, seed - Random seed
+ * Returns: The mine cell indices, in the order they were picked
+ */
+std::vector<int> GameEngine::generateMineLayout(int cells, int mines, std::uint32_t seed)
+{
+    std::mt19937 rng(seed);
+    std::vector<bool> taken(static_cast<size_t>(cells), false);
+    std::vector<int> layout;
+    while (static_cast<int>(layout.size()) < mines && static_cast<int>(layout.size()) < cells)
+    {
+        // Only place a mine if there isn't one there already
+        int index = static_cast<int>(boundedRandom(rng, static_cast<std::uint32_t>(cells)));
+        if (!taken[index])
+        {
+            taken[index] = true;
+            layout.push_back(index);
+        }
+    }
+    return layout;
+}
+
+/*
+ * Function: placeMines
+ * Description: Places the mines on the board, only after the first click
+ * Parameters: layout - Mine cell indices (e.g. from generateMineLayout)
+ */
+void GameEngine::placeMines(const std::vector<int> &layout)
+{
+    for (int index : layout)
+        board.edit(index).setMine(true);
+    hiddenSafe = width * height - static_cast<int>(layout.size());
+    calculateAdjacency(layout);
+}
+
+/*
+ * Function: calculateAdjacency
+ * Description: Calculates the number of adjacent mines for each square on the board.
+ *              Works outward from the mines, so only squares next to a mine are touched.
+ * Parameters: layout - Mine cell indices
+ */
+void GameEngine::calculateAdjacency(const std::vector<int> &layout)
+{
+    for (int index : layout)
+    {
+        int row = index / width;
+        int col = index % width;
+        for (int dr = -1; dr <= 1; ++dr)
+        {
+            for (int dc = -1; dc <= 1; ++dc)
+            {
+                int r = row + dr;
+                int c = col + dc;
+                // Skip mines - they don't need numbers!
+                if ((dr == 0 && dc == 0) || !isInside(r, c) || board.get(r * width + c).getIsMine())
+                    continue;
+                Space &space = board.edit(r * width + c);
+                space.setAdjacentMines(space.getAdjacentMines() + 1);
+            }
+        }
+    }
+}
+
+/*
+ * Function: floodReveal
+ * Description: Reveals a safe space and every space reachable through spaces with no
+ *              adjacent mines. Uses an explicit stack so large boards can't overflow the call stack.
+ * Parameters: row - The row of the square, col - The column of the square
+ */
+void GameEngine::floodReveal(int row, int col)
+{
+    floodStack.clear();
+    floodStack.push_back(row * width + col);
+    while (!floodStack.empty())
+    {
+        int index = floodStack.back();
+        floodStack.pop_back();
+        const Space &current = board.get(index);
+        if (current.getIsRevealed() || current.getIsMine())
+            continue;
+
+        // Remove any mark if it's there and show what's under this square
+        Space &space = board.edit(index);
+        space.setFlagged(false);
+        space.setIsQuestion(false);
+        space.setRevealed(true);
+        changedCells.push_back(index);
+        --hiddenSafe;
+
+        if (space.getAdjacentMines() != 0)
+            continue;
+        int r = index / width;
+        int c = index % width;
+        for (int dr = -1; dr <= 1; ++dr)
+            for (int dc = -1; dc <= 1; ++dc)
+                if ((dr != 0 || dc != 0) && isInside(r + dr, c + dc) &&
+                    !board.get((r + dr) * width + c + dc).getIsRevealed())
+                    floodStack.push_back((r + dr) * width + c + dc);
+    }
+}
+
+/*
+ * Function: revealMine
+ * Description: Ends the game on a mine and reports every mine as changed so they can be shown
+ * Parameters: row - The row of the mine, col - The column of the mine
+ */
+void GameEngine::revealMine(int row, int col)
+{
+    status = Status::Lost;
+    board.edit(row * width + col).setRevealed(true);
+    for (int i = 0; i < width * height; ++i)
+    {
+        if (board.get(i).getIsMine())
+            changedCells.push_back(i);
+    }
+}
+
+/*
+ * Function: restoreSnapshot
+ * Description: Puts the game back to a saved state (history is left to the caller)
+ * Parameters: snapshot - The state to go back to
+ */
+void GameEngine::restoreSnapshot(const Snapshot &snapshot)
+{
+    board = snapshot.board;
+    hiddenSafe = snapshot.hiddenSafe;
+    status = snapshot.status;
+    firstClick = snapshot.firstClick;
+    seed = snapshot.seed;
+}
+
+/*
+ * Function: record
+ * Description: Adds the move just made to the undo history and counts it as a click, if it changed anything
+ * Parameters: before - The state before the move
+ */
+void GameEngine::record(Snapshot &&before)
+{
+    if (changedCells.empty())
+        return;
+    ++clicks;
+    undoStack.push_back(HistoryEntry { std::move(before), changedCells });
+    redoStack.clear();
+}
+
+/*
+ * Function: jump
+ * Description: Moves one step through history: restores the top state of one stack and
+ *              pushes the current state onto the other
+ * Parameters: from - Stack to take the state from, to - Stack to save the current state on
+ */
+void GameEngine::jump(std::vector<HistoryEntry> &from, std::vector<HistoryEntry> &to)
+{
+    HistoryEntry entry = std::move(from.back());
+    from.pop_back();
+    to.push_back(HistoryEntry { saveSnapshot(), entry.changed });
+    restoreSnapshot(entry.before);
+    changedCells = std::move(entry.changed);
+}
+
+/*
+ * Function: checkWin
+ * Description: Checks if game is won- we win if all non-mine squares are revealed
+ */
+void GameEngine::checkWin()
+{
+    // Every reveal of a safe square counts down hiddenSafe, so no board scan is needed
+    if (hiddenSafe == 0)
+        status = Status::Won;
+}
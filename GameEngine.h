@@ -0,0 +1,128 @@
+/*
+ * Author: Martin Nguyen
+ * Description: Headless Minesweeper engine (game rules without any Qt dependency)
+ * Date: 10/19/2026
+ */
+
+#ifndef GAMEENGINE_H
+#define GAMEENGINE_H
+
+// System/standard libraries
+#include <vector>
+#include <random>
+#include <cstdint>
+
+#include "PersistentBoard.h"
+
+class GameEngine {
+public:
+    // Game status
+    enum class Status { Playing, Won, Lost };
+
+    // Saved game state. Copying one is O(1): the board chunks are shared copy-on-write.
+    struct Snapshot {
+        PersistentBoard board;
+        int hiddenSafe;
+        Status status;
+        bool firstClick;
+        std::uint32_t seed;
+    };
+
+    // Default board (matches the Qt front end)
+    static constexpr int DEFAULT_WIDTH = 30;
+    static constexpr int DEFAULT_HEIGHT = 16;
+    static constexpr int DEFAULT_MINES = 20;
+
+    // Largest board loadLayout accepts
+    static constexpr int MAX_CELLS = 1 << 24;
+
+    // Constructor and destructor
+    GameEngine(int width = DEFAULT_WIDTH, int height = DEFAULT_HEIGHT, int mines = DEFAULT_MINES);
+    virtual ~GameEngine();
+
+    // Game setup
+    void reset();
+    void reset(int width, int height, int mines);
+    void setSeed(std::uint32_t newSeed);
+    bool loadLayout(int width, int height, const std::vector<int> &layout);
+
+    // Moves
+    int reveal(int row, int col);
+    int chord(int row, int col);
+    void toggleFlag(int row, int col);
+    void toggleQuestion(int row, int col);
+    void cycleMark(int row, int col);
+
+    // History: every move that changes the board can be undone and redone
+    bool undo();
+    bool redo();
+    bool canUndo() const;
+    bool canRedo() const;
+
+    // What-if: try moves, then throw them all away (or keep them)
+    void beginWhatIf();
+    bool rollbackWhatIf();
+    bool commitWhatIf();
+    int getWhatIfDepth() const;
+
+    // Cheap copy of the current state (e.g. to compare against later)
+    Snapshot saveSnapshot() const;
+
+    // Getters (public)
+    int getWidth() const;
+    int getHeight() const;
+    int getMines() const;
+    std::uint32_t getSeed() const;
+    Status getStatus() const;
+    int getClicks() const;
+    int getThreeBV() const;
+    bool isInside(int row, int col) const;
+    bool isMine(int row, int col) const;
+    const Space& getSpace(int row, int col) const;
+    const std::vector<int>& getChangedCells() const;
+
+    // Mine layout used for a given seed (shared with GameBatch so both place the same mines)
+    static std::vector<int> generateMineLayout(int cells, int mines, std::uint32_t seed);
+
+private:
+    // One undoable move: the state before it and the cells it changed
+    struct HistoryEntry {
+        Snapshot before;
+        std::vector<int> changed;
+    };
+
+    // An open what-if branch: where to go back to
+    struct WhatIf {
+        Snapshot start;
+        size_t undoSize;
+        std::vector<HistoryEntry> redoStack;
+    };
+
+    // Instance variables
+    int width;
+    int height;
+    int mines;
+    std::uint32_t seed;
+    PersistentBoard board; // row-major, index = row * width + col
+    std::vector<int> changedCells; // cells touched by the last move
+    std::vector<int> floodStack;
+    int hiddenSafe; // safe squares not revealed yet
+    Status status;
+    bool firstClick;
+    int clicks; // moves that changed the board; undo doesn't take them back
+    std::vector<HistoryEntry> undoStack;
+    std::vector<HistoryEntry> redoStack;
+    std::vector<WhatIf> whatIfs;
+
+    // Private functions
+    void restoreSnapshot(const Snapshot &snapshot);
+    void record(Snapshot &&before);
+    void revealMine(int row, int col);
+    void jump(std::vector<HistoryEntry> &from, std::vector<HistoryEntry> &to);
+    void placeMines(const std::vector<int> &layout);
+    void calculateAdjacency(const std::vector<int> &layout);
+    void floodReveal(int row, int col);
+    void checkWin();
+};
+
+#endif // GAMEENGINE_H
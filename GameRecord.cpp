@@ -0,0 +1,122 @@
+/*
+ * Author: Martin Nguyen
+ * Description: Implementation of the GameRecord struct for Minesweeper game
+ * Date: 10/19/2026
+ */
+
+#include "GameRecord.h"
+
+// Column names and widths in bytes, indexed by GameRecord::Column
+static const char *const COLUMN_NAMES[GameRecord::COLUMN_COUNT] = {
+    "seed", "width", "height", "mines", "density", "3bv", "clicks", "guesses", "outcome", "duration"
+};
+static const int COLUMN_WIDTHS[GameRecord::COLUMN_COUNT] = { 4, 2, 2, 4, 4, 4, 4, 4, 1, 8 };
+
+/*
+ * Function: get
+ * Description: Gets one field as a column value
+ * Parameters: column - The column
+ * Returns: The field's value (0 for an unknown column)
+ */
+std::uint64_t GameRecord::get(int column) const
+{
+    switch (column)
+    {
+    case SEED: return seed;
+    case WIDTH: return width;
+    case HEIGHT: return height;
+    case MINES: return mines;
+    case DENSITY: return density;
+    case THREE_BV: return threeBV;
+    case CLICKS: return clicks;
+    case GUESSES: return guesses;
+    case OUTCOME: return outcome;
+    case DURATION: return durationMicros;
+    default: return 0;
+    }
+}
+
+/*
+ * Function: set
+ * Description: Sets one field from a column value
+ * Parameters: column - The column, value - The value (cut to the column's width)
+ */
+void GameRecord::set(int column, std::uint64_t value)
+{
+    switch (column)
+    {
+    case SEED: seed = static_cast<std::uint32_t>(value); break;
+    case WIDTH: width = static_cast<std::uint16_t>(value); break;
+    case HEIGHT: height = static_cast<std::uint16_t>(value); break;
+    case MINES: mines = static_cast<std::uint32_t>(value); break;
+    case DENSITY: density = static_cast<std::uint32_t>(value); break;
+    case THREE_BV: threeBV = static_cast<std::uint32_t>(value); break;
+    case CLICKS: clicks = static_cast<std::uint32_t>(value); break;
+    case GUESSES: guesses = static_cast<std::uint32_t>(value); break;
+    case OUTCOME: outcome = static_cast<std::uint8_t>(value); break;
+    case DURATION: durationMicros = value; break;
+    default: break;
+    }
+}
+
+/*
+ * Function: getColumnWidth
+ * Description: Gets how many bytes a column takes per row when stored uncompressed
+ * Parameters: column - The column
+ * Returns: Width in bytes (0 for an unknown column)
+ */
+int GameRecord::getColumnWidth(int column)
+{
+    return column >= 0 && column < COLUMN_COUNT ? COLUMN_WIDTHS[column] : 0;
+}
+
+/*
+ * Function: getColumnName
+ * Description: Gets the name of a column
+ * Parameters: column - The column
+ * Returns: The name ("" for an unknown column)
+ */
+const char *GameRecord::getColumnName(int column)
+{
+    return column >= 0 && column < COLUMN_COUNT ? COLUMN_NAMES[column] : "";
+}
+
+/*
+ * Function: findColumn
+ * Description: Looks up a column by name
+ * Parameters: name - The column name
+ * Returns: The column, or -1 if there is none with that name
+ */
+int GameRecord::findColumn(const std::string &name)
+{
+    for (int column = 0; column < COLUMN_COUNT; ++column)
+    {
+        if (name == COLUMN_NAMES[column])
+            return column;
+    }
+    return -1;
+}
+
+/*
+ * Function: fromEngine
+ * Description: Builds the record for the engine's current game
+ * Parameters: engine - The game, guesses - Number of guessed reveals, durationMicros - Time played
+ * Returns: The record
+ */
+GameRecord GameRecord::fromEngine(const GameEngine &engine, int guesses, std::uint64_t durationMicros)
+{
+    GameRecord record;
+    std::uint64_t cells = static_cast<std::uint64_t>(engine.getWidth()) * engine.getHeight();
+    record.seed = engine.getSeed();
+    record.width = static_cast<std::uint16_t>(engine.getWidth());
+    record.height = static_cast<std::uint16_t>(engine.getHeight());
+    record.mines = static_cast<std::uint32_t>(engine.getMines());
+    record.density = cells == 0 ? 0 : static_cast<std::uint32_t>(engine.getMines() * 1000000ull / cells);
+    record.threeBV = static_cast<std::uint32_t>(engine.getThreeBV());
+    record.clicks = static_cast<std::uint32_t>(engine.getClicks());
+    record.guesses = static_cast<std::uint32_t>(guesses);
+    record.outcome = engine.getStatus() == GameEngine::Status::Won ? WON
+                     : engine.getStatus() == GameEngine::Status::Lost ? LOST : PLAYING;
+    record.durationMicros = durationMicros;
+    return record;
+}
@@ -0,0 +1,54 @@
+/*
+ * Author: Martin Nguyen
+ * Description: GameRecord struct, the statistics kept for one finished (or abandoned) game
+ * Date: 10/19/2026
+ *
+ * Records are stored column by column (see StatsWriter), so every field is also a
+ * numbered column with a fixed width in bytes. Column numbers are part of the file
+ * format: add new columns at the end.
+ */
+
+#ifndef GAMERECORD_H
+#define GAMERECORD_H
+
+// System/standard libraries
+#include <cstdint>
+#include <string>
+
+#include "GameEngine.h"
+
+struct GameRecord {
+    // Columns, in file order
+    enum Column {
+        SEED, WIDTH, HEIGHT, MINES, DENSITY, THREE_BV, CLICKS, GUESSES, OUTCOME, DURATION,
+        COLUMN_COUNT
+    };
+
+    // Outcome values (same numbering as the game server's status byte)
+    static constexpr std::uint8_t PLAYING = 0; // abandoned before the end
+    static constexpr std::uint8_t WON = 1;
+    static constexpr std::uint8_t LOST = 2;
+
+    std::uint32_t seed;
+    std::uint16_t width;
+    std::uint16_t height;
+    std::uint32_t mines;
+    std::uint32_t density;        // mines per million squares
+    std::uint32_t threeBV;
+    std::uint32_t clicks;
+    std::uint32_t guesses;        // reveals of squares that weren't proven safe
+    std::uint8_t outcome;
+    std::uint64_t durationMicros;
+
+    // Column access
+    std::uint64_t get(int column) const;
+    void set(int column, std::uint64_t value);
+    static int getColumnWidth(int column);
+    static const char* getColumnName(int column);
+    static int findColumn(const std::string &name);
+
+    // Fills in everything the engine knows; guesses and duration come from whoever ran the game
+    static GameRecord fromEngine(const GameEngine &engine, int guesses, std::uint64_t durationMicros);
+};
+
+#endif // GAMERECORD_H
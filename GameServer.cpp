@@ -0,0 +1,516 @@
+/*
+ * Author: Martin Nguyen
+ * Description: Implementation of the GameServer class (see GameServer.h for the protocol)
+ * Date: 10/19/2026
+ */
+
+#include "GameServer.h"
+
+// System libraries
+#include <arpa/inet.h>
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace {
+
+// Little-endian helpers for the wire format
+std::uint16_t readU16(const std::uint8_t *p)
+{
+    return static_cast<std::uint16_t>(p[0] | (p[1] << 8));
+}
+
+std::uint32_t readU32(const std::uint8_t *p)
+{
+    return static_cast<std::uint32_t>(p[0]) | (static_cast<std::uint32_t>(p[1]) << 8) |
+           (static_cast<std::uint32_t>(p[2]) << 16) | (static_cast<std::uint32_t>(p[3]) << 24);
+}
+
+void appendU32(std::vector<std::uint8_t> &out, std::uint32_t value)
+{
+    out.push_back(static_cast<std::uint8_t>(value));
+    out.push_back(static_cast<std::uint8_t>(value >> 8));
+    out.push_back(static_cast<std::uint8_t>(value >> 16));
+    out.push_back(static_cast<std::uint8_t>(value >> 24));
+}
+
+} // namespace
+
+/*
+ * Constructor: GameServer
+ * Description: Creates the epoll instance; call listenUnix/listenTcp before run
+ */
+GameServer::GameServer() : epollFd(epoll_create1(EPOLL_CLOEXEC)), running(false), analysis(false)
+{
+    if (epollFd < 0)
+        std::cerr << "GameServer: epoll_create1 failed: " << std::strerror(errno) << std::endl;
+}
+
+/*
+ * Destructor: GameServer
+ * Description: Closes every client and listening socket
+ */
+GameServer::~GameServer()
+{
+    for (auto &entry : connections)
+        close(entry.first);
+    for (int fd : listenFds)
+        close(fd);
+    if (!unixPath.empty())
+        unlink(unixPath.c_str());
+    if (epollFd >= 0)
+        close(epollFd);
+}
+
+/*
+ * Function: listenUnix
+ * Description: Accepts bot connections on a Unix domain socket (replaces any stale socket file)
+ * Parameters: path - Filesystem path of the socket
+ * Returns: true on success, false otherwise
+ */
+bool GameServer::listenUnix(const std::string &path)
+{
+    sockaddr_un addr {};
+    if (path.size() >= sizeof(addr.sun_path))
+    {
+        std::cerr << "GameServer: socket path too long: " << path << std::endl;
+        return false;
+    }
+    int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (fd < 0)
+    {
+        std::cerr << "GameServer: socket failed: " << std::strerror(errno) << std::endl;
+        return false;
+    }
+    addr.sun_family = AF_UNIX;
+    std::memcpy(addr.sun_path, path.c_str(), path.size() + 1);
+    unlink(path.c_str());
+    if (bind(fd, reinterpret_cast<sockaddr *>(&addr), sizeof(addr)) < 0 || listen(fd, SOMAXCONN) < 0)
+    {
+        std::cerr << "GameServer: cannot listen on " << path << ": " << std::strerror(errno) << std::endl;
+        close(fd);
+        return false;
+    }
+    unixPath = path;
+    return addListener(fd);
+}
+
+/*
+ * Function: listenTcp
+ * Description: Accepts bot connections on a loopback TCP port (127.0.0.1 only)
+ * Parameters: port - TCP port number
+ * Returns: true on success, false otherwise
+ */
+bool GameServer::listenTcp(std::uint16_t port)
+{
+    int fd = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (fd < 0)
+    {
+        std::cerr << "GameServer: socket failed: " << std::strerror(errno) << std::endl;
+        return false;
+    }
+    int one = 1;
+    setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+
+    sockaddr_in addr {};
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(port);
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    if (bind(fd, reinterpret_cast<sockaddr *>(&addr), sizeof(addr)) < 0 || listen(fd, SOMAXCONN) < 0)
+    {
+        std::cerr << "GameServer: cannot listen on port " << port << ": " << std::strerror(errno) << std::endl;
+        close(fd);
+        return false;
+    }
+    return addListener(fd);
+}
+
+/*
+ * Function: run
+ * Description: Runs the event loop until stop is called
+ */
+void GameServer::run()
+{
+    constexpr int MAX_EVENTS = 256;
+    epoll_event events[MAX_EVENTS];
+    running = true;
+
+    while (running)
+    {
+        int ready = epoll_wait(epollFd, events, MAX_EVENTS, -1);
+        if (ready < 0)
+        {
+            if (errno == EINTR)
+                continue; // woken by a signal, re-check running
+            std::cerr << "GameServer: epoll_wait failed: " << std::strerror(errno) << std::endl;
+            break;
+        }
+
+        for (int i = 0; i < ready; ++i)
+        {
+            int fd = events[i].data.fd;
+            auto it = connections.find(fd);
+            if (it == connections.end())
+            {
+                acceptConnections(fd); // only listeners are not in the connection table
+                continue;
+            }
+
+            Connection &conn = *it->second;
+            bool open = true;
+            if (events[i].events & EPOLLIN)
+                open = readAvailable(conn);
+            // Flush once per batch so pipelined requests go out together. If the batch
+            // stopped at the output limit and went out in full, answer the next one.
+            while (open)
+            {
+                open = handleFrames(conn);
+                if (!open || conn.out.empty())
+                    break;
+                open = flush(conn);
+                if (conn.waitingForWrite)
+                    break;
+            }
+            if (events[i].events & (EPOLLHUP | EPOLLERR))
+                open = false;
+            if (!open)
+                closeConnection(fd);
+        }
+    }
+}
+
+/*
+ * Function: stop
+ * Description: Asks the event loop to exit (safe to call from a signal handler)
+ */
+void GameServer::stop()
+{
+    running = false;
+}
+
+/*
+ * Function: setAnalysis
+ * Description: Turns analysis mode (undo, redo and what-if requests) on or off
+ * Parameters: enabled - true to allow the history opcodes
+ */
+void GameServer::setAnalysis(bool enabled)
+{
+    analysis = enabled;
+}
+
+/*
+ * Function: getConnectionCount
+ * Description: Gets the number of connected clients
+ * Returns: Number of open connections
+ */
+size_t GameServer::getConnectionCount() const
+{
+    return connections.size();
+}
+
+/*
+ * Function: addListener
+ * Description: Registers a listening socket with epoll
+ * Parameters: fd - The listening socket
+ * Returns: true on success, false otherwise
+ */
+bool GameServer::addListener(int fd)
+{
+    epoll_event event {};
+    event.events = EPOLLIN;
+    event.data.fd = fd;
+    if (epoll_ctl(epollFd, EPOLL_CTL_ADD, fd, &event) < 0)
+    {
+        std::cerr << "GameServer: epoll_ctl failed: " << std::strerror(errno) << std::endl;
+        close(fd);
+        return false;
+    }
+    listenFds.push_back(fd);
+    return true;
+}
+
+/*
+ * Function: acceptConnections
+ * Description: Accepts every pending client on a listening socket and gives each its own engine
+ * Parameters: listenFd - The listening socket
+ */
+void GameServer::acceptConnections(int listenFd)
+{
+    while (true)
+    {
+        int fd = accept4(listenFd, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if (fd < 0)
+        {
+            if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)
+                std::cerr << "GameServer: accept failed: " << std::strerror(errno) << std::endl;
+            return;
+        }
+
+        // Small frames: don't let Nagle hold back replies (harmless on Unix sockets)
+        int one = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+
+        epoll_event event {};
+        event.events = EPOLLIN;
+        event.data.fd = fd;
+        if (epoll_ctl(epollFd, EPOLL_CTL_ADD, fd, &event) < 0)
+        {
+            close(fd);
+            continue;
+        }
+
+        std::unique_ptr<Connection> conn(new Connection());
+        conn->fd = fd;
+        conn->outPos = 0;
+        conn->waitingForWrite = false;
+        connections[fd] = std::move(conn);
+    }
+}
+
+/*
+ * Function: readAvailable
+ * Description: Reads what the socket has buffered into the connection's input buffer, up to
+ *              MAX_PENDING_INPUT bytes (the rest stays in the socket until those are answered)
+ * Parameters: conn - The client connection
+ * Returns: false if the peer closed the connection or an error occurred
+ */
+bool GameServer::readAvailable(Connection &conn)
+{
+    std::uint8_t chunk[16384];
+    while (conn.in.size() < MAX_PENDING_INPUT)
+    {
+        ssize_t n = recv(conn.fd, chunk, sizeof(chunk), 0);
+        if (n > 0)
+        {
+            conn.in.insert(conn.in.end(), chunk, chunk + n);
+            if (static_cast<size_t>(n) < sizeof(chunk))
+                return true; // drained
+            continue;
+        }
+        if (n == 0)
+            return false;
+        if (errno == EINTR)
+            continue;
+        return errno == EAGAIN || errno == EWOULDBLOCK;
+    }
+    return true;
+}
+
+/*
+ * Function: handleFrames
+ * Description: Answers the complete requests in the input buffer, leaving any partial frame
+ *              behind. Stops early once MAX_PENDING_OUTPUT bytes of responses are unsent.
+ * Parameters: conn - The client connection
+ * Returns: false if the client broke the protocol and must be disconnected
+ */
+bool GameServer::handleFrames(Connection &conn)
+{
+    size_t pos = 0;
+    while (conn.in.size() - pos >= 4 && conn.out.size() - conn.outPos < MAX_PENDING_OUTPUT)
+    {
+        std::uint32_t length = readU32(&conn.in[pos]);
+        if (length == 0 || length > MAX_FRAME)
+            return false;
+        if (conn.in.size() - pos - 4 < length)
+            break; // wait for the rest of the frame
+        handleRequest(conn, &conn.in[pos + 4], length);
+        pos += 4 + length;
+    }
+    conn.in.erase(conn.in.begin(), conn.in.begin() + static_cast<std::ptrdiff_t>(pos));
+    return true;
+}
+
+/*
+ * Function: handleRequest
+ * Description: Applies one request to the connection's engine and queues the response
+ * Parameters: conn - The client connection, data - Request payload, length - Payload size
+ */
+void GameServer::handleRequest(Connection &conn, const std::uint8_t *data, std::uint32_t length)
+{
+    static const std::vector<int> noCells;
+    GameEngine &engine = conn.engine;
+    std::uint8_t opcode = data[0];
+
+    switch (opcode)
+    {
+    case OP_NEW:
+    {
+        if (length < 13)
+            break;
+        int width = readU16(data + 1);
+        int height = readU16(data + 3);
+        std::uint32_t mines = readU32(data + 5);
+        std::uint32_t seed = readU32(data + 9);
+        std::uint32_t cells = static_cast<std::uint32_t>(width) * height;
+        if (width == 0 || height == 0 || cells > MAX_CELLS || mines >= cells)
+            break;
+        engine.reset(width, height, static_cast<int>(mines));
+        if (seed != 0)
+            engine.setSeed(seed);
+        writeResponse(conn, opcode, STATUS_PLAYING, noCells);
+        return;
+    }
+    case OP_REVEAL:
+    case OP_FLAG:
+    case OP_CHORD:
+    {
+        if (length < 5)
+            break;
+        int row = readU16(data + 1);
+        int col = readU16(data + 3);
+        if (!engine.isInside(row, col))
+            break;
+        if (opcode == OP_REVEAL)
+            engine.reveal(row, col);
+        else if (opcode == OP_FLAG)
+            engine.toggleFlag(row, col);
+        else
+            engine.chord(row, col);
+        writeResponse(conn, opcode, static_cast<std::uint8_t>(engine.getStatus()), engine.getChangedCells());
+        return;
+    }
+    case OP_BOARD:
+    {
+        std::vector<int> all(static_cast<size_t>(engine.getWidth()) * engine.getHeight());
+        for (size_t i = 0; i < all.size(); ++i)
+            all[i] = static_cast<int>(i);
+        writeResponse(conn, opcode, static_cast<std::uint8_t>(engine.getStatus()), all);
+        return;
+    }
+    case OP_UNDO:
+    case OP_REDO:
+    case OP_WHATIF:
+    case OP_ROLLBACK:
+    case OP_COMMIT:
+    {
+        // A lost game has shown its mines, so it must not be taken back
+        bool lost = engine.getStatus() == GameEngine::Status::Lost;
+        if (!analysis || (lost && (opcode == OP_UNDO || opcode == OP_ROLLBACK)))
+            break;
+        bool ok = true;
+        if (opcode == OP_UNDO)
+            ok = engine.undo();
+        else if (opcode == OP_REDO)
+            ok = engine.redo();
+        else if (opcode == OP_WHATIF)
+            engine.beginWhatIf();
+        else if (opcode == OP_ROLLBACK)
+            ok = engine.rollbackWhatIf();
+        else
+            ok = engine.commitWhatIf();
+        if (!ok)
+            break;
+        writeResponse(conn, opcode, static_cast<std::uint8_t>(engine.getStatus()), engine.getChangedCells());
+        return;
+    }
+    default:
+        break;
+    }
+    writeResponse(conn, opcode, STATUS_ERROR, noCells);
+}
+
+/*
+ * Function: writeResponse
+ * Description: Appends a response frame to the connection's output buffer
+ * Parameters: conn - The client connection, opcode - Request opcode, status - Response status,
+ *             cells - Cells to report with their current codes
+ */
+void GameServer::writeResponse(Connection &conn, std::uint8_t opcode, std::uint8_t status, const std::vector<int> &cells)
+{
+    std::vector<std::uint8_t> &out = conn.out;
+    appendU32(out, static_cast<std::uint32_t>(6 + cells.size() * 5));
+    out.push_back(opcode);
+    out.push_back(status);
+    appendU32(out, static_cast<std::uint32_t>(cells.size()));
+    for (int index : cells)
+    {
+        appendU32(out, static_cast<std::uint32_t>(index));
+        out.push_back(cellCode(conn.engine, index));
+    }
+}
+
+/*
+ * Function: flush
+ * Description: Sends as much queued output as the socket takes. For the rest it waits for
+ *              EPOLLOUT, and stops watching for requests until everything has gone out.
+ * Parameters: conn - The client connection
+ * Returns: false if the connection failed
+ */
+bool GameServer::flush(Connection &conn)
+{
+    while (conn.outPos < conn.out.size())
+    {
+        ssize_t n = send(conn.fd, conn.out.data() + conn.outPos, conn.out.size() - conn.outPos, MSG_NOSIGNAL);
+        if (n > 0)
+        {
+            conn.outPos += static_cast<size_t>(n);
+            continue;
+        }
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+        {
+            if (!conn.waitingForWrite)
+            {
+                epoll_event event {};
+                event.events = EPOLLOUT;
+                event.data.fd = conn.fd;
+                epoll_ctl(epollFd, EPOLL_CTL_MOD, conn.fd, &event);
+                conn.waitingForWrite = true;
+            }
+            return true;
+        }
+        return false;
+    }
+
+    conn.out.clear();
+    conn.outPos = 0;
+    if (conn.waitingForWrite)
+    {
+        epoll_event event {};
+        event.events = EPOLLIN;
+        event.data.fd = conn.fd;
+        epoll_ctl(epollFd, EPOLL_CTL_MOD, conn.fd, &event);
+        conn.waitingForWrite = false;
+    }
+    return true;
+}
+
+/*
+ * Function: closeConnection
+ * Description: Closes a client and frees its engine
+ * Parameters: fd - The client socket
+ */
+void GameServer::closeConnection(int fd)
+{
+    epoll_ctl(epollFd, EPOLL_CTL_DEL, fd, nullptr);
+    close(fd);
+    connections.erase(fd);
+}
+
+/*
+ * Function: cellCode
+ * Description: Encodes what a client is allowed to see of a cell
+ * Parameters: engine - The game, index - Cell index (row * width + col)
+ * Returns: 0-8 for revealed numbers, otherwise one of the CELL_ codes
+ */
+std::uint8_t GameServer::cellCode(const GameEngine &engine, int index)
+{
+    const Space &space = engine.getSpace(index / engine.getWidth(), index % engine.getWidth());
+    bool showMine = space.getIsMine() && (space.getIsRevealed() || engine.getStatus() == GameEngine::Status::Lost);
+    if (showMine)
+        return CELL_MINE;
+    if (space.getIsRevealed())
+        return static_cast<std::uint8_t>(space.getAdjacentMines());
+    if (space.getIsFlagged())
+        return CELL_FLAG;
+    if (space.getIsQuestion())
+        return CELL_QUESTION;
+    return CELL_HIDDEN;
+}
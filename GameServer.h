@@ -0,0 +1,132 @@
+/*
+ * Author: Martin Nguyen
+ * Description: Local headless game server for bot clients (Linux, epoll based)
+ * Date: 10/19/2026
+ *
+ * Every connection owns one GameEngine. Messages in both directions are frames:
+ *
+ *   u32 length | payload[length]          (all integers little-endian)
+ *
+ * Request payloads (first byte is the opcode):
+ *   OP_NEW    u16 width, u16 height, u32 mines, u32 seed (0 = random)
+ *   OP_REVEAL u16 row, u16 col
+ *   OP_FLAG   u16 row, u16 col           (toggles a flag)
+ *   OP_CHORD  u16 row, u16 col
+ *   OP_BOARD  (no arguments, returns every cell)
+ *   OP_UNDO, OP_REDO                      (no arguments; analysis mode only)
+ *   OP_WHATIF, OP_ROLLBACK, OP_COMMIT     (no arguments: open, roll back or keep a what-if branch;
+ *                                          analysis mode only)
+ *
+ * Response payload:
+ *   u8 opcode, u8 status, u32 count, count x (u32 cell index, u8 cell code)
+ *
+ * status is STATUS_PLAYING/WON/LOST or STATUS_ERROR, cell index is row * width + col
+ * and cell codes are 0-8 (revealed number), CELL_MINE, CELL_FLAG, CELL_QUESTION or CELL_HIDDEN.
+ * Undo, redo and rollback report the cells they changed; asking with nothing to undo,
+ * redo or close is an error.
+ *
+ * Analysis mode (setAnalysis) is off by default, and without it the five history
+ * opcodes are errors: otherwise a bot could try a move, see the mines when it loses
+ * and take it back. Even in analysis mode, a game that has been lost (so the mines
+ * have been shown) can't be undone or rolled back. All complete requests read in one wakeup are answered
+ * with a single send.
+ *
+ * A client that doesn't read its responses can't make the server buffer without limit:
+ * requests stop being answered once MAX_PENDING_OUTPUT bytes are waiting to be sent,
+ * and the connection isn't read again until they have gone out.
+ */
+
+#ifndef GAMESERVER_H
+#define GAMESERVER_H
+
+// System/standard libraries
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "GameEngine.h"
+
+class GameServer {
+public:
+    // Request opcodes
+    static constexpr std::uint8_t OP_NEW = 1;
+    static constexpr std::uint8_t OP_REVEAL = 2;
+    static constexpr std::uint8_t OP_FLAG = 3;
+    static constexpr std::uint8_t OP_CHORD = 4;
+    static constexpr std::uint8_t OP_BOARD = 5;
+    static constexpr std::uint8_t OP_UNDO = 6;
+    static constexpr std::uint8_t OP_REDO = 7;
+    static constexpr std::uint8_t OP_WHATIF = 8;
+    static constexpr std::uint8_t OP_ROLLBACK = 9;
+    static constexpr std::uint8_t OP_COMMIT = 10;
+
+    // Response status codes
+    static constexpr std::uint8_t STATUS_PLAYING = 0;
+    static constexpr std::uint8_t STATUS_WON = 1;
+    static constexpr std::uint8_t STATUS_LOST = 2;
+    static constexpr std::uint8_t STATUS_ERROR = 0xFF;
+
+    // Cell codes (0-8 are revealed numbers)
+    static constexpr std::uint8_t CELL_MINE = 9;
+    static constexpr std::uint8_t CELL_FLAG = 10;
+    static constexpr std::uint8_t CELL_QUESTION = 11;
+    static constexpr std::uint8_t CELL_HIDDEN = 12;
+
+    // Largest request we accept; anything bigger closes the connection
+    static constexpr std::uint32_t MAX_FRAME = 64;
+
+    // Largest board a client may ask for
+    static constexpr std::uint32_t MAX_CELLS = 1u << 20;
+
+    // Buffering per connection: unanswered request bytes read ahead, and unsent response
+    // bytes after which requests wait (one OP_BOARD response can go past it)
+    static constexpr size_t MAX_PENDING_INPUT = 64 * 1024;
+    static constexpr size_t MAX_PENDING_OUTPUT = 1024 * 1024;
+
+    // Constructor and destructor
+    GameServer();
+    virtual ~GameServer();
+
+    // Public functions
+    bool listenUnix(const std::string &path);
+    bool listenTcp(std::uint16_t port);
+    void run();
+    void stop();
+    void setAnalysis(bool enabled);
+    size_t getConnectionCount() const;
+
+private:
+    // One client and its game
+    struct Connection {
+        int fd;
+        GameEngine engine;
+        std::vector<std::uint8_t> in;
+        std::vector<std::uint8_t> out;
+        size_t outPos;
+        bool waitingForWrite;
+    };
+
+    // Instance variables
+    int epollFd;
+    std::vector<int> listenFds;
+    std::string unixPath;
+    std::unordered_map<int, std::unique_ptr<Connection>> connections;
+    std::atomic<bool> running;
+    bool analysis; // allow undo, redo and what-if
+
+    // Private functions
+    bool addListener(int fd);
+    void acceptConnections(int listenFd);
+    bool readAvailable(Connection &conn);
+    bool handleFrames(Connection &conn);
+    void handleRequest(Connection &conn, const std::uint8_t *data, std::uint32_t length);
+    void writeResponse(Connection &conn, std::uint8_t opcode, std::uint8_t status, const std::vector<int> &cells);
+    bool flush(Connection &conn);
+    void closeConnection(int fd);
+    static std::uint8_t cellCode(const GameEngine &engine, int index);
+};
+
+#endif // GAMESERVER_H
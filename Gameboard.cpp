@@ -5,32 +5,75 @@
  */
 
 #include "Gameboard.h"
+#include "TileCache.h"
 #include <QApplication>
+#include <QDir>
+#include <QKeySequence>
+#include <QShortcut>
+#include <QStandardPaths>
 
 /*
  * Constructor: Gameboard
  * Description: Initializes a new gameboard with default values
  * Parameters: parent - Parent widget (managed by Qt)
  */
-Gameboard::Gameboard(QWidget *parent) : QWidget(parent), gameOver(false), firstClick(true)
+Gameboard::Gameboard(QWidget *parent)
+    : QWidget(parent), engine(WIDTH, HEIGHT, MINES), guesses(0), patternCancel(false)
 {
     gridLayout = new QGridLayout(this);
     gridLayout->setSpacing(0);
     setLayout(gridLayout);
 
-    // Initialize the button grid
+    // Initialize the button grid. The buttons themselves are the first frame, so they are built
+    // here; what waits is everything else: fresh buttons are already blank (no reset pass),
+    // the engine places mines on the first click, and the tiles and pattern table are set up
+    // in finishStartup once the frame is up.
     buttons.resize(HEIGHT, std::vector<QPushButton *>(WIDTH));
+    buttonDirty.assign(WIDTH * HEIGHT, false);
     createButtons();
 
-    resetBoard();
+    // Undo/redo of reveals, chords and marks
+    connect(new QShortcut(QKeySequence::Undo, this), &QShortcut::activated, this, &Gameboard::undoMove);
+    connect(new QShortcut(QKeySequence::Redo, this), &QShortcut::activated, this, &Gameboard::redoMove);
 }
 
 /*
  * Destructor: Gameboard
- * Description: Destroys the gameboard object (managed by Qt)
+ * Description: Destroys the gameboard object (managed by Qt). A game quit halfway is still recorded.
  */
 Gameboard::~Gameboard()
 {
+    if (engine.getStatus() == GameEngine::Status::Playing && engine.getClicks() > 0)
+        recordGame();
+    patternCancel = true;
+    if (patternLoader.joinable())
+        patternLoader.join(); // quick: generating stops at the next game
+}
+
+/*
+ * Function: finishStartup
+ * Description: Does the startup work that can wait until the first frame is up (the main
+ *              window calls it then): renders the tiles, and loads the solver's pattern table
+ *              in the background (generating and saving it on the first run)
+ */
+void Gameboard::finishStartup()
+{
+    TileCache::warmUp();
+
+    QString path = dataFilePath("patterns.bin");
+    if (path.isEmpty())
+        return;
+    patternLoader = std::thread([this, file = path.toStdString()]() {
+        std::shared_ptr<PatternDatabase> table = std::make_shared<PatternDatabase>();
+        table->loadOrGenerate(file, PatternDatabase::DEFAULT_GAMES, &patternCancel);
+        if (patternCancel)
+            return;
+        // Hand the table over on the GUI thread, where the solver runs
+        QMetaObject::invokeMethod(this, [this, table]() {
+            patterns = table;
+            solver = Solver(patterns.get());
+        }, Qt::QueuedConnection);
+    });
 }
 
 /*
@@ -39,22 +82,19 @@ Gameboard::~Gameboard()
  */
 void Gameboard::resetBoard()
 {
-    board.clear();
-    board.resize(HEIGHT, std::vector<Space>(WIDTH));
-    mineMap.clear();
-    gameOver = false;
-    firstClick = true;
+    engine.reset();
+    guesses = 0;
+    gameTimer.invalidate();
 
-    // Reset all buttons
-    for (int row = 0; row < HEIGHT; ++row)
+    // Reset only the buttons that were changed during the last game
+    for (int index : dirtyButtons)
     {
-        for (int col = 0; col < WIDTH; ++col)
-        {
-            buttons[row][col]->setText("");
-            buttons[row][col]->setEnabled(true);
-            buttons[row][col]->setStyleSheet("");
-        }
+        QPushButton *button = buttons[index / WIDTH][index % WIDTH];
+        button->setIcon(QIcon());
+        button->setEnabled(true);
+        buttonDirty[index] = false;
     }
+    dirtyButtons.clear();
 }
 
 /*
@@ -65,61 +105,29 @@ void Gameboard::resetBoard()
  */
 bool Gameboard::isMine(int row, int col)
 {
-    return mineMap.find(row) != mineMap.end() &&
-           mineMap[row].find(col) != mineMap[row].end();
+    return engine.isMine(row, col);
 }
 
 /*
  * Function: getSpace
  * Description: Gets a reference to a space on the board
  * Parameters: row - The row of the square, col - The column of the square
- * Returns: A reference to the space at the given row and column
+ * Returns: A read-only reference to the space at the given row and column
  */
-Space &Gameboard::getSpace(int row, int col)
+const Space &Gameboard::getSpace(int row, int col)
 {
-    return board[row][col];
+    return engine.getSpace(row, col);
 }
 
 /*
  * Function: revealSpace
- * Description: Reveals a space on the board, and recursively reveals all adjacent spaces if the space has no adjacent mines (flood fill)
+ * Description: Reveals a space on the board, and all adjacent spaces if the space has no adjacent mines (flood fill)
  * Parameters: row - The row of the square, col - The column of the square
  */
 void Gameboard::revealSpace(int row, int col)
 {
-    // Stay within the boundaries of the board
-    if (row < 0 || row >= HEIGHT || col < 0 || col >= WIDTH)
-        return;
-
-    // If space is already revealed, do nothing
-    if (board[row][col].getIsRevealed())
-        return;
-
-    // Remove any flag if it's there
-    if (board[row][col].getIsFlagged())
-        board[row][col].setFlagged(false);
-
-    // Show what's under this square
-    board[row][col].setRevealed(true);
-    updateButton(row, col);
-
-    // If space is a mine, stop here
-    if (isMine(row, col))
-        return;
-
-    // If no adjacent mines, reveal all adjacent spaces (flood fill)
-    if (countAdjacentMines(row, col) == 0)
-    {
-        for (int dr = -1; dr <= 1; ++dr)
-        {
-            for (int dc = -1; dc <= 1; ++dc)
-            {
-                if (dr == 0 && dc == 0)
-                    continue;                    // skip current square
-                revealSpace(row + dr, col + dc); // reveal neighbors recursively
-            }
-        }
-    }
+    engine.reveal(row, col);
+    updateChangedButtons();
 }
 
 /*
@@ -129,12 +137,8 @@ void Gameboard::revealSpace(int row, int col)
  */
 void Gameboard::flagSpace(int row, int col)
 {
-    if (board[row][col].getIsRevealed())
-        return; // can't flag revealed squares!
-
-    // Toggle the flag (if it's there, remove it; if it's not, add it)
-    bool isCurrentlyFlagged = board[row][col].getIsFlagged();
-    board[row][col].setFlagged(!isCurrentlyFlagged);
+    engine.toggleFlag(row, col);
+    updateChangedButtons();
 }
 
 /*
@@ -144,12 +148,8 @@ void Gameboard::flagSpace(int row, int col)
  */
 void Gameboard::questionSpace(int row, int col)
 {
-    if (board[row][col].getIsRevealed())
-        return; // can't question revealed squares!
-
-    // Toggle the question mark
-    bool isCurrentlyQuestion = board[row][col].getIsQuestion();
-    board[row][col].setIsQuestion(!isCurrentlyQuestion);
+    engine.toggleQuestion(row, col);
+    updateChangedButtons();
 }
 
 /*
@@ -158,105 +158,26 @@ void Gameboard::questionSpace(int row, int col)
  */
 void Gameboard::createButtons()
 {
+    // Don't repaint or relayout while 480 buttons are added
+    setUpdatesEnabled(false);
     for (int row = 0; row < HEIGHT; ++row)
     {
         for (int col = 0; col < WIDTH; ++col)
         {
             QPushButton *button = new QPushButton(this);
             button->setFixedSize(30, 30);
-            button->setProperty("row", row);
-            button->setProperty("col", col);
+            button->setIconSize(QSize(TileCache::TILE_SIZE, TileCache::TILE_SIZE));
 
-            connect(button, &QPushButton::clicked, this, &Gameboard::handleButtonClick);
-            connect(button, &QPushButton::customContextMenuRequested, this, &Gameboard::handleButtonRightClick);
+            // The lambdas remember the position, so no properties or sender() lookups are needed
+            connect(button, &QPushButton::clicked, this, [this, row, col]() { handleButtonClick(row, col); });
+            connect(button, &QPushButton::customContextMenuRequested, this, [this, row, col]() { handleButtonRightClick(row, col); });
             button->setContextMenuPolicy(Qt::CustomContextMenu);
 
             gridLayout->addWidget(button, row, col);
             buttons[row][col] = button;
         }
     }
-}
-
-/*
- * Function: placeMines
- * Description: Places all the mines randomly on the board, only after the first click
- */
-void Gameboard::placeMines()
-{
-    std::srand(std::time(0)); // Use a random seed by using the current time
-    mineMap.clear();          // Reset the mine map
-
-    int minesPlaced = 0;
-    while (minesPlaced < MINES)
-    {
-        // Pick random spots for mines
-        int row = std::rand() % HEIGHT;
-        int col = std::rand() % WIDTH;
-
-        // Only place a mine if there isn't one there already
-        if (mineMap.find(row) == mineMap.end() || mineMap[row].find(col) == mineMap[row].end())
-        {
-            mineMap[row].insert(col); // Insert the mine into the mine map
-            board[row][col].setMine(true);
-            ++minesPlaced;
-        }
-    }
-}
-
-/*
- * Function: calculateAdjacency
- * Description: Calculates the number of adjacent mines for each square on the board
- */
-void Gameboard::calculateAdjacency()
-{
-    for (int row = 0; row < HEIGHT; ++row)
-    {
-        for (int col = 0; col < WIDTH; ++col)
-        {
-            // Skip mines - they don't need numbers!
-            if (!board[row][col].getIsMine())
-            {
-                int count = countAdjacentMines(row, col);
-                board[row][col].setAdjacentMines(count);
-            }
-        }
-    }
-}
-
-/*
- * Function: countAdjacentMines
- * Description: Counts the number of adjacent mines for a given square
- * Parameters: row - The row of the square, col - The column of the square
- * Returns: The number of adjacent mines
- */
-int Gameboard::countAdjacentMines(int row, int col)
-{
-    int count = 0;
-    // Check all 8 squares around this one
-    for (int dr = -1; dr <= 1; ++dr)
-    {
-        for (int dc = -1; dc <= 1; ++dc)
-        {
-            if (dr == 0 && dc == 0)
-                continue; // skip the square itself
-
-            // Look at each neighbor
-            int newRow = row + dr;
-            int newCol = col + dc;
-
-            // Make sure we're still on the board
-            if (newRow >= 0 && newRow < HEIGHT && newCol >= 0 && newCol < WIDTH)
-            {
-                // If there's a mine there, count it!
-                if (mineMap.find(newRow) != mineMap.end() &&
-                    mineMap[newRow].find(newCol) != mineMap[newRow].end())
-                {
-                    count++;
-                }
-            }
-        }
-    }
-    return count;
+    setUpdatesEnabled(true);
 }
 
 /*
@@ -267,178 +188,120 @@ int Gameboard::countAdjacentMines(int row, int col)
 void Gameboard::updateButton(int row, int col)
 {
     QPushButton *button = buttons[row][col];
-    Space &space = board[row][col];
+    const Space &space = engine.getSpace(row, col);
 
-    if (space.getIsRevealed())
+    // Remember the button so resetBoard can restore it
+    int index = row * WIDTH + col;
+    if (!buttonDirty[index])
     {
-        button->setEnabled(false); // can't click revealed squares
-        if (isMine(row, col))
-        {
-            button->setText("💣"); // show the mine if mine is clicked.
-        }
-        else
-        {
-            int adjacentMines = countAdjacentMines(row, col);
-            button->setText(""); // Blank the square by default.
-            if (adjacentMines > 0)
-            {
-                button->setText(QString::number(adjacentMines));
-                // Make each number a different color, shows danger level of the square.
-                QString color;
-                switch (adjacentMines)
-                {
-                case 1:
-                    color = "blue";
-                    break;
-                case 2:
-                    color = "green";
-                    break;
-                case 3:
-                    color = "red";
-                    break;
-                case 4:
-                    color = "darkblue";
-                    break;
-                case 5:
-                    color = "darkred";
-                    break;
-                case 6:
-                    color = "teal";
-                    break;
-                case 7:
-                    color = "black";
-                    break;
-                case 8:
-                    color = "gray";
-                    break;
-                }
-                button->setStyleSheet("color: " + color + ";");
-            }
-        }
+        buttonDirty[index] = true;
+        dirtyButtons.push_back(index);
+    }
+
+    // Tiles are rendered once by TileCache, so updating a button is just swapping its icon.
+    // Undo can hide a square again, so hidden squares are always re-enabled.
+    button->setEnabled(!space.getIsRevealed() || space.getIsMine());
+    if (space.getIsMine() && engine.getStatus() == GameEngine::Status::Lost)
+    {
+        button->setIcon(TileCache::mine()); // show every mine once a mine is clicked.
+    }
+    else if (space.getIsRevealed())
+    {
+        int adjacentMines = space.getAdjacentMines();
+        // Blank the square unless it has a number; each number has its own danger colour.
+        button->setIcon(adjacentMines > 0 ? TileCache::number(adjacentMines) : QIcon());
     }
     else if (space.getIsFlagged())
     {
-        button->setText("🚩"); // show flag
+        button->setIcon(TileCache::flag()); // show flag
     }
     else if (space.getIsQuestion())
     {
-        button->setText("❓"); // show question mark
+        button->setIcon(TileCache::question()); // show question mark
     }
     else
     {
-        button->setText(""); // Blank the square by default.
+        button->setIcon(QIcon()); // Blank the square by default.
     }
 }
 
 /*
- * Function: checkWin
- * Description: Checks if game is won- we win if all non-mine squares are revealed
+ * Function: updateChangedButtons
+ * Description: Updates the buttons for every square the last engine move touched
  */
-void Gameboard::checkWin()
+void Gameboard::updateChangedButtons()
 {
-    bool allNonMinesRevealed = true;
-    for (int row = 0; row < HEIGHT; ++row)
-    {
-        for (int col = 0; col < WIDTH; ++col)
-        {
-            // If safe square is still unrevealed, we haven't won yet
-            if (!isMine(row, col) && !board[row][col].getIsRevealed())
-            {
-                allNonMinesRevealed = false;
-                break;
-            }
-        }
-        if (!allNonMinesRevealed)
-            break;
-    }
+    for (int index : engine.getChangedCells())
+        updateButton(index / WIDTH, index % WIDTH);
+}
 
-    // If everything except mines is revealed, game is won.
-    if (allNonMinesRevealed)
-    {
-        gameOver = true;
-        handleGameOver(true);
-    }
+/*
+ * Function: checkGameOver
+ * Description: Shows the game over screen once the engine says the game is won or lost
+ */
+void Gameboard::checkGameOver()
+{
+    if (engine.getStatus() != GameEngine::Status::Playing)
+        handleGameOver(engine.getStatus() == GameEngine::Status::Won);
 }
 
 /*
  * Function: handleButtonClick
  * Description: Handles the click event for a button
+ * Parameters: row - The row of the button, col - The column of the button
  */
-void Gameboard::handleButtonClick()
+void Gameboard::handleButtonClick(int row, int col)
 {
-    if (gameOver)
+    if (engine.getStatus() != GameEngine::Status::Playing)
         return;
 
-    QPushButton *button = qobject_cast<QPushButton *>(sender());
-    int row = button->property("row").toInt();
-    int col = button->property("col").toInt();
-
-    // If first click, place mines and calculate adjacency
-    if (firstClick)
+    // A reveal no nearby number proves safe is a guess (the first click always is)
+    if (!engine.getSpace(row, col).getIsRevealed())
     {
-        placeMines();
-        calculateAdjacency();
-        firstClick = false;
+        if (!gameTimer.isValid())
+            gameTimer.start();
+        if (!solver.isForcedSafe(engine, row, col))
+            ++guesses;
     }
 
-    if (isMine(row, col))
-    {
-        gameOver = true;
-        // Reveal all mines
-        for (int r = 0; r < HEIGHT; ++r)
-        {
-            for (int c = 0; c < WIDTH; ++c)
-            {
-                if (isMine(r, c))
-                {
-                    buttons[r][c]->setText("💣");
-                }
-            }
-        }
-
-        handleGameOver(false);
-    }
-    else
-    {
-        revealSpace(row, col);
-        checkWin();
-    }
+    // Mines are placed by the engine on the first click
+    revealSpace(row, col);
+    checkGameOver();
 }
 
 /*
  * Function: handleButtonRightClick
  * Description: Handles the right-click event for a button
+ * Parameters: row - The row of the button, col - The column of the button
  */
-void Gameboard::handleButtonRightClick()
+void Gameboard::handleButtonRightClick(int row, int col)
 {
-    if (gameOver)
+    if (engine.getStatus() != GameEngine::Status::Playing)
         return; // can't do anything if game's done
 
-    // Figure out which button got right-clicked
-    QPushButton *button = qobject_cast<QPushButton *>(sender());
-    int row = button->property("row").toInt();
-    int col = button->property("col").toInt();
+    // This cycles through: empty -> flag -> question -> empty (can't flag a number!)
+    engine.cycleMark(row, col);
+    updateChangedButtons(); // show the changes
+}
+
+/*
+ * Function: undoMove
+ * Description: Takes back the last move
+ */
+void Gameboard::undoMove()
+{
+    if (engine.undo())
+        updateChangedButtons();
+}
 
-    // Only work with unrevealed squares (can't flag a number!)
-    if (!board[row][col].getIsRevealed())
-    {
-        // This cycles through: empty -> flag -> question -> empty
-        if (board[row][col].getIsFlagged())
-        {
-            board[row][col].setFlagged(false);
-            questionSpace(row, col); // make it a question mark
-        }
-        else if (board[row][col].getIsQuestion())
-        {
-            board[row][col].setIsQuestion(false);
-            board[row][col].setFlagged(false); // back to empty
-        }
-        else
-        {
-            flagSpace(row, col); // make it a flag
-        }
-        updateButton(row, col); // show the changes
-    }
+/*
+ * Function: redoMove
+ * Description: Plays back the last undone move
+ */
+void Gameboard::redoMove()
+{
+    if (engine.redo())
+        updateChangedButtons();
 }
 
 /*
@@ -447,7 +310,8 @@ void Gameboard::handleButtonRightClick()
  */
 void Gameboard::handleGameOver(bool isWin)
 {
-    gameOver = true;
+    recordGame(); // before the dialog, so the time doesn't include it
+
     // Different message for winning vs losing
     QString message = isWin ? "Congratulations! You won!" : "Game Over! You hit a mine!";
     QMessageBox msgBox;
@@ -468,3 +332,35 @@ void Gameboard::handleGameOver(bool isWin)
         QApplication::quit(); // they're done playing, quit the game.
     }
 }
+
+/*
+ * Function: recordGame
+ * Description: Queues the current game's statistics for the stats file (opened on first use,
+ *              in the app data folder). Never waits: if the writer is behind, the record is dropped.
+ *              Each game is written as its own chunk, so quitting abruptly loses at most the last one.
+ */
+void Gameboard::recordGame()
+{
+    if (!stats.isOpen())
+    {
+        QString path = dataFilePath("games.stats");
+        if (path.isEmpty() || !stats.open(path.toStdString(), true, 1))
+            return;
+    }
+    std::uint64_t micros = gameTimer.isValid() ? static_cast<std::uint64_t>(gameTimer.nsecsElapsed() / 1000) : 0;
+    stats.tryPush(GameRecord::fromEngine(engine, guesses, micros));
+}
+
+/*
+ * Function: dataFilePath
+ * Description: Gets the path of a file in the app data folder, creating the folder if needed
+ * Parameters: name - The file name
+ * Returns: The path, or an empty string if there is no writable data folder
+ */
+QString Gameboard::dataFilePath(const QString &name)
+{
+    QString folder = QStandardPaths::writableLocation(QStandardPaths::AppDataLocation);
+    if (folder.isEmpty() || !QDir().mkpath(folder))
+        return QString();
+    return QDir(folder).filePath(name);
+}
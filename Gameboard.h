@@ -9,20 +9,22 @@
 #define GAMEBOARD_H
 
 // System/standard libraries
+#include <atomic>
+#include <memory>
+#include <thread>
 #include <vector>
-#include <unordered_set>
-#include <unordered_map>
-#include <utility>
-#include <cstdlib>
-#include <ctime>
 
 // Qt libraries
 #include <QWidget>
 #include <QPushButton>
 #include <QGridLayout>
 #include <QMessageBox>
+#include <QElapsedTimer>
 
-#include "Space.h"
+#include "GameEngine.h"
+#include "PatternDatabase.h"
+#include "Solver.h"
+#include "StatsWriter.h"
 
 class Gameboard : public QWidget {
     Q_OBJECT
@@ -33,9 +35,10 @@ public:
     virtual ~Gameboard();
 
     // Public functions
+    void finishStartup();
     void resetBoard();
     bool isMine(int row, int col);
-    Space& getSpace(int row, int col);
+    const Space& getSpace(int row, int col);
     void revealSpace(int row, int col);
     void flagSpace(int row, int col);
     void questionSpace(int row, int col);
@@ -47,23 +50,31 @@ private:
     static constexpr int MINES = 20;
 
     // Instance variables
-    std::vector<std::vector<Space>> board;
-    std::unordered_map<int, std::unordered_set<int>> mineMap; // Using a dictionary-like implementation to store bomb locations.
+    GameEngine engine; // Game rules and board state live in the headless engine.
     QGridLayout* gridLayout;
     std::vector<std::vector<QPushButton*>> buttons;
-    bool gameOver;
-    bool firstClick;
+    std::vector<bool> buttonDirty; // buttons that differ from a fresh blank button
+    std::vector<int> dirtyButtons;
+    Solver solver; // tells guesses from reveals the numbers already proved safe
+    std::shared_ptr<const PatternDatabase> patterns; // the solver's table, once loaded
+    std::thread patternLoader;
+    std::atomic<bool> patternCancel; // set on close so a first-run table build stops early
+    int guesses;
+    QElapsedTimer gameTimer; // started by the first reveal
+    StatsWriter stats; // per-game records, written on a background thread
 
     // Private functions
     void createButtons();
-    void placeMines();
-    void calculateAdjacency();
-    int countAdjacentMines(int row, int col);
     void updateButton(int row, int col);
-    void checkWin();
-    void handleButtonClick();
-    void handleButtonRightClick();
+    void updateChangedButtons();
+    void checkGameOver();
+    void handleButtonClick(int row, int col);
+    void handleButtonRightClick(int row, int col);
+    void undoMove();
+    void redoMove();
     void handleGameOver(bool isWin);
+    void recordGame();
+    static QString dataFilePath(const QString &name);
 
 
 };
@@ -0,0 +1,410 @@
+/*
+ * Author: Martin Nguyen
+ * Description: Implementation of the LayoutCodec class for Minesweeper game
+ * Date: 10/19/2026
+ */
+
+#include "LayoutCodec.h"
+
+// System/standard libraries
+#include <algorithm>
+#include <cmath>
+
+/*
+ * Constructor: LayoutCodec
+ * Description: Sets up the codec for one board size and mine count, working out how big ranks get
+ * Parameters: cells - Number of cells on the board, mines - Number of mines in every layout
+ */
+LayoutCodec::LayoutCodec(int cells, int mines)
+    : cells(cells), mines(mines), ranked(false), limbs(0), rankBytes(0)
+{
+    if (cells <= 0 || mines < 0 || mines > cells)
+        return;
+    ranked = true;
+    if (mines == 0 || mines == cells)
+        return; // only one layout, so its rank takes no bytes
+
+    // A slight underestimate of the limbs ranks need, from log2 C(cells, mines), rules out
+    // tables too big to build without the exact bignum work below
+    double logBinomial = (std::lgamma(cells + 1.0) - std::lgamma(mines + 1.0) - std::lgamma(cells - mines + 1.0)) / std::log(2.0);
+    double fewestLimbs = std::max(std::floor((logBinomial - 1.0) / 32.0), 0.0);
+    if (static_cast<double>(cells) * (mines + 1) * fewestLimbs * sizeof(std::uint32_t) > static_cast<double>(RANK_TABLE_BYTES))
+    {
+        ranked = false;
+        return;
+    }
+
+    // C(cells, mines) = product of (cells - i + 1) / i, exact at every step; it's below 2^cells
+    Number total(static_cast<size_t>(cells) / 32 + 2, 0);
+    total[0] = 1;
+    for (int i = 1; i <= mines; ++i)
+    {
+        multiply(total, static_cast<std::uint32_t>(cells - i + 1));
+        divide(total, static_cast<std::uint32_t>(i));
+    }
+    int bits = bitLength(total);
+    limbs = (bits + 31) / 32;
+    rankBytes = (bits + 7) / 8;
+    size_t tableSize = static_cast<size_t>(cells) * static_cast<size_t>(mines + 1) * static_cast<size_t>(limbs);
+    if (tableSize * sizeof(std::uint32_t) > RANK_TABLE_BYTES)
+    {
+        ranked = false;
+        rankBytes = 0;
+        return;
+    }
+
+    // Pascal's triangle, C(n, j) = C(n - 1, j - 1) + C(n - 1, j), capped at C(cells, mines)
+    binomials.assign(tableSize, 0);
+    for (int n = 0; n < cells; ++n)
+    {
+        binomials[static_cast<size_t>(n) * limbs] = 1; // C(n, 0)
+        for (int j = 1; j <= mines && j <= n; ++j)
+        {
+            std::uint32_t *entry = &binomials[(static_cast<size_t>(j) * cells + n) * limbs];
+            const std::uint32_t *left = binomial(n - 1, j - 1);
+            const std::uint32_t *right = binomial(n - 1, j);
+            std::uint64_t carry = 0;
+            for (int i = 0; i < limbs; ++i)
+            {
+                std::uint64_t sum = static_cast<std::uint64_t>(left[i]) + right[i] + carry;
+                entry[i] = static_cast<std::uint32_t>(sum);
+                carry = sum >> 32;
+            }
+            if (carry != 0 || !lessOrEqual(entry, total.data(), limbs))
+                std::copy(total.begin(), total.begin() + limbs, entry);
+        }
+    }
+}
+
+/*
+ * Destructor: LayoutCodec
+ * Description: Destroys the codec object
+ */
+LayoutCodec::~LayoutCodec()
+{
+}
+
+/*
+ * Function: encode
+ * Description: Appends the record for a layout, in whichever codec is shorter
+ * Parameters: layout - The mine cells (getMines() distinct cells, any order), out - Buffer to append to
+ */
+void LayoutCodec::encode(const std::vector<int> &layout, std::vector<std::uint8_t> &out) const
+{
+    std::vector<int> sorted(layout);
+    std::sort(sorted.begin(), sorted.end());
+
+    size_t start = out.size();
+    out.push_back(CODEC_DELTA);
+    int previous = -1;
+    for (int cell : sorted)
+    {
+        std::uint32_t gap = static_cast<std::uint32_t>(cell - previous - 1);
+        while (gap >= 0x80)
+        {
+            out.push_back(static_cast<std::uint8_t>(gap | 0x80));
+            gap >>= 7;
+        }
+        out.push_back(static_cast<std::uint8_t>(gap));
+        previous = cell;
+    }
+    if (!ranked || out.size() - start - 1 <= static_cast<size_t>(rankBytes))
+        return;
+
+    out.resize(start);
+    out.push_back(CODEC_RANK);
+    out.resize(start + 1 + static_cast<size_t>(rankBytes));
+    if (rankBytes > 0)
+        encodeRank(sorted, &out[start + 1]);
+}
+
+/*
+ * Function: decode
+ * Description: Decodes a record
+ * Parameters: record - Start of the record, end - End of the readable data, layout - Set to the mine cells (sorted)
+ * Returns: true on success, false if the record is damaged
+ */
+bool LayoutCodec::decode(const std::uint8_t *record, const std::uint8_t *end, std::vector<int> &layout) const
+{
+    if (record >= end)
+        return false;
+    std::uint8_t codec = *record++;
+    if (codec == CODEC_RANK)
+        return ranked && end - record >= rankBytes && decodeRank(record, layout);
+    if (codec != CODEC_DELTA)
+        return false;
+
+    layout.resize(static_cast<size_t>(mines));
+    std::int64_t previous = -1;
+    for (int i = 0; i < mines; ++i)
+    {
+        std::uint64_t gap = 0;
+        for (int shift = 0; ; shift += 7)
+        {
+            if (record == end || shift > 35)
+                return false;
+            std::uint8_t byte = *record++;
+            gap |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+            if (byte < 0x80)
+                break;
+        }
+        previous += static_cast<std::int64_t>(gap) + 1;
+        if (previous >= cells)
+            return false;
+        layout[i] = static_cast<int>(previous);
+    }
+    return true;
+}
+
+/*
+ * Function: skip
+ * Description: Finds the end of a record without decoding it
+ * Parameters: record - Start of the record, end - End of the readable data
+ * Returns: The start of the next record, or nullptr if the record is damaged
+ */
+const std::uint8_t *LayoutCodec::skip(const std::uint8_t *record, const std::uint8_t *end) const
+{
+    if (record >= end)
+        return nullptr;
+    std::uint8_t codec = *record++;
+    if (codec == CODEC_RANK)
+        return ranked && end - record >= rankBytes ? record + rankBytes : nullptr;
+    if (codec != CODEC_DELTA)
+        return nullptr;
+
+    // Every varint ends on the one byte without the continuation bit
+    for (int remaining = mines; remaining > 0; --remaining)
+    {
+        while (record != end && *record >= 0x80)
+            ++record;
+        if (record == end)
+            return nullptr;
+        ++record;
+    }
+    return record;
+}
+
+/*
+ * Function: getCells
+ * Description: Gets the number of cells on the board
+ * Returns: Cell count
+ */
+int LayoutCodec::getCells() const
+{
+    return cells;
+}
+
+/*
+ * Function: getMines
+ * Description: Gets the number of mines in every layout
+ * Returns: Mine count
+ */
+int LayoutCodec::getMines() const
+{
+    return mines;
+}
+
+/*
+ * Function: getRankBytes
+ * Description: Gets the size of a rank (0 if there's only one layout or ranks aren't used)
+ * Returns: Bytes per rank
+ */
+int LayoutCodec::getRankBytes() const
+{
+    return rankBytes;
+}
+
+/*
+ * Function: hashRecord
+ * Description: Hashes a record together with its board id (FNV-1a), so records that are
+ *              damaged or out of place both change a segment's checksum
+ * Parameters: id - Board id, record - The record, size - Record length in bytes
+ * Returns: The hash
+ */
+std::uint64_t LayoutCodec::hashRecord(std::uint64_t id, const std::uint8_t *record, size_t size)
+{
+    std::uint64_t hash = 0xCBF29CE484222325ull;
+    for (int i = 0; i < 8; ++i)
+        hash = (hash ^ ((id >> (8 * i)) & 0xFF)) * 0x100000001B3ull;
+    for (size_t i = 0; i < size; ++i)
+        hash = (hash ^ record[i]) * 0x100000001B3ull;
+    return hash;
+}
+
+/*
+ * Function: encodeRank
+ * Description: Works out a layout's rank, the sum of C(cell_i, i) over the sorted cells
+ * Parameters: sorted - The mine cells in increasing order, out - Where to write the rank (getRankBytes() bytes)
+ */
+void LayoutCodec::encodeRank(const std::vector<int> &sorted, std::uint8_t *out) const
+{
+    Number rank(static_cast<size_t>(limbs), 0);
+    for (size_t i = 0; i < sorted.size(); ++i)
+        add(rank.data(), binomial(sorted[i], static_cast<int>(i) + 1), limbs);
+
+    for (int i = 0; i < rankBytes; ++i)
+        out[i] = static_cast<std::uint8_t>(rank[static_cast<size_t>(i / 4)] >> (8 * (i % 4)));
+}
+
+/*
+ * Function: decodeRank
+ * Description: Turns a rank back into a layout. From the last mine down, mine j is on the
+ *              highest cell c with C(c, j) no bigger than what's left of the rank.
+ * Parameters: in - The rank (getRankBytes() bytes), layout - Set to the mine cells (sorted)
+ * Returns: true on success, false if the rank is out of range
+ */
+bool LayoutCodec::decodeRank(const std::uint8_t *in, std::vector<int> &layout) const
+{
+    layout.resize(static_cast<size_t>(mines));
+    if (mines == 0 || mines == cells)
+    {
+        for (int i = 0; i < mines; ++i)
+            layout[i] = i;
+        return true;
+    }
+
+    Number rank(static_cast<size_t>(limbs), 0);
+    for (int i = 0; i < rankBytes; ++i)
+        rank[static_cast<size_t>(i / 4)] |= static_cast<std::uint32_t>(in[i]) << (8 * (i % 4));
+
+    int high = cells - 1;
+    for (int j = mines; j > 0; --j)
+    {
+        // C(c, j) grows with c and is 0 at c = j - 1, so the search always finds a cell.
+        // Mines are usually a few cells apart, so gallop down from the last one before bisecting.
+        if (high < j - 1)
+            return false;
+        int low = high;
+        for (int step = 1; low > j - 1 && !lessOrEqual(binomial(low, j), rank.data(), limbs); step *= 2)
+        {
+            high = low - 1;
+            low = std::max(j - 1, low - step);
+        }
+        while (low < high)
+        {
+            int middle = low + (high - low + 1) / 2;
+            if (lessOrEqual(binomial(middle, j), rank.data(), limbs))
+                low = middle;
+            else
+                high = middle - 1;
+        }
+        subtract(rank.data(), binomial(low, j), limbs);
+        layout[static_cast<size_t>(j - 1)] = low;
+        high = low - 1;
+    }
+
+    // A valid rank is used up exactly
+    return std::all_of(rank.begin(), rank.end(), [](std::uint32_t limb) { return limb == 0; });
+}
+
+/*
+ * Function: binomial
+ * Description: Looks up C(n, j) (capped at C(cells, mines)) in the table
+ * Parameters: n - Cell, j - Mine number (0 to getMines())
+ * Returns: The number, limbs long
+ */
+const std::uint32_t *LayoutCodec::binomial(int n, int j) const
+{
+    return &binomials[(static_cast<size_t>(j) * cells + n) * limbs];
+}
+
+/*
+ * Function: multiply
+ * Description: Multiplies a big number by a small one in place
+ * Parameters: number - The big number, factor - The small number
+ */
+void LayoutCodec::multiply(Number &number, std::uint32_t factor)
+{
+    std::uint64_t carry = 0;
+    for (std::uint32_t &limb : number)
+    {
+        std::uint64_t product = static_cast<std::uint64_t>(limb) * factor + carry;
+        limb = static_cast<std::uint32_t>(product);
+        carry = product >> 32;
+    }
+}
+
+/*
+ * Function: divide
+ * Description: Divides a big number by a small one in place (the callers only divide exactly)
+ * Parameters: number - The big number, divisor - The small number
+ */
+void LayoutCodec::divide(Number &number, std::uint32_t divisor)
+{
+    std::uint64_t remainder = 0;
+    for (size_t i = number.size(); i-- > 0;)
+    {
+        std::uint64_t current = (remainder << 32) | number[i];
+        number[i] = static_cast<std::uint32_t>(current / divisor);
+        remainder = current % divisor;
+    }
+}
+
+/*
+ * Function: add
+ * Description: Adds one big number to another in place
+ * Parameters: number - The number added to, other - The number to add, limbs - Length of both
+ */
+void LayoutCodec::add(std::uint32_t *number, const std::uint32_t *other, int limbs)
+{
+    std::uint64_t carry = 0;
+    for (int i = 0; i < limbs; ++i)
+    {
+        std::uint64_t sum = static_cast<std::uint64_t>(number[i]) + other[i] + carry;
+        number[i] = static_cast<std::uint32_t>(sum);
+        carry = sum >> 32;
+    }
+}
+
+/*
+ * Function: subtract
+ * Description: Subtracts one big number from another in place (other must not be larger)
+ * Parameters: number - The number subtracted from, other - The number to subtract, limbs - Length of both
+ */
+void LayoutCodec::subtract(std::uint32_t *number, const std::uint32_t *other, int limbs)
+{
+    std::uint64_t borrow = 0;
+    for (int i = 0; i < limbs; ++i)
+    {
+        std::uint64_t difference = static_cast<std::uint64_t>(number[i]) - other[i] - borrow;
+        number[i] = static_cast<std::uint32_t>(difference);
+        borrow = (difference >> 32) & 1;
+    }
+}
+
+/*
+ * Function: lessOrEqual
+ * Description: Compares two big numbers of the same length
+ * Parameters: number - The left side, other - The right side, limbs - Length of both
+ * Returns: true if number <= other
+ */
+bool LayoutCodec::lessOrEqual(const std::uint32_t *number, const std::uint32_t *other, int limbs)
+{
+    for (int i = limbs; i-- > 0;)
+    {
+        if (number[i] != other[i])
+            return number[i] < other[i];
+    }
+    return true;
+}
+
+/*
+ * Function: bitLength
+ * Description: Gets the number of bits needed to write a big number
+ * Parameters: number - The big number
+ * Returns: Index of the highest set bit plus one (0 for zero)
+ */
+int LayoutCodec::bitLength(const Number &number)
+{
+    for (size_t i = number.size(); i-- > 0;)
+    {
+        if (number[i] != 0)
+        {
+            int bits = 0;
+            for (std::uint32_t limb = number[i]; limb != 0; limb >>= 1)
+                ++bits;
+            return static_cast<int>(i) * 32 + bits;
+        }
+    }
+    return 0;
+}
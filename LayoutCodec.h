@@ -0,0 +1,79 @@
+/*
+ * Author: Martin Nguyen
+ * Description: LayoutCodec class, compact encoding of a mine layout (the set of mine cells)
+ * Date: 10/19/2026
+ *
+ * A record is one codec byte followed by either:
+ *   CODEC_DELTA  the mine cells in increasing order as gaps, each a varint
+ *                (first cell, then cells skipped since the previous mine)
+ *   CODEC_RANK   the layout's rank in the combinatorial number system,
+ *                sum of C(cell_i, i) over the sorted cells (i from 1), as a
+ *                fixed-size little-endian number of getRankBytes() bytes
+ *
+ * Every layout with k mines on n cells has a rank below C(n, k), so the rank is within a
+ * byte of the information-theoretic minimum. encode picks whichever form is shorter.
+ * Ranks are big numbers. The codec keeps a table of every C(n, j) it can need (capped at
+ * C(cells, mines), since anything larger never fits in a rank), so encoding is one
+ * addition per mine and decoding one binary search per mine. Board sizes whose table
+ * would pass RANK_TABLE_BYTES only use deltas.
+ */
+
+#ifndef LAYOUTCODEC_H
+#define LAYOUTCODEC_H
+
+// System/standard libraries
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class LayoutCodec {
+public:
+    // Record codecs
+    static constexpr std::uint8_t CODEC_DELTA = 0;
+    static constexpr std::uint8_t CODEC_RANK = 1;
+
+    // Largest binomial table a codec builds for rank coding
+    static constexpr size_t RANK_TABLE_BYTES = 32u << 20;
+
+    // Constructor and destructor
+    LayoutCodec(int cells = 0, int mines = 0);
+    virtual ~LayoutCodec();
+
+    // Encoding (safe to call from several threads at once)
+    void encode(const std::vector<int> &layout, std::vector<std::uint8_t> &out) const;
+    bool decode(const std::uint8_t *record, const std::uint8_t *end, std::vector<int> &layout) const;
+    const std::uint8_t* skip(const std::uint8_t *record, const std::uint8_t *end) const;
+
+    // Getters (public)
+    int getCells() const;
+    int getMines() const;
+    int getRankBytes() const;
+
+    // Checksum of one stored record
+    static std::uint64_t hashRecord(std::uint64_t id, const std::uint8_t *record, size_t size);
+
+private:
+    // Big numbers are little-endian arrays of 32-bit limbs, all `limbs` long
+    using Number = std::vector<std::uint32_t>;
+
+    // Instance variables
+    int cells;
+    int mines;
+    bool ranked; // false for boards too big to rank
+    int limbs; // enough for C(cells, mines)
+    int rankBytes;
+    std::vector<std::uint32_t> binomials; // C(n, j) for n < cells, j <= mines, at (j * cells + n) * limbs
+
+    // Private functions
+    void encodeRank(const std::vector<int> &sorted, std::uint8_t *out) const;
+    bool decodeRank(const std::uint8_t *in, std::vector<int> &layout) const;
+    const std::uint32_t* binomial(int n, int j) const;
+    static void multiply(Number &number, std::uint32_t factor);
+    static void divide(Number &number, std::uint32_t divisor);
+    static void add(std::uint32_t *number, const std::uint32_t *other, int limbs);
+    static void subtract(std::uint32_t *number, const std::uint32_t *other, int limbs);
+    static bool lessOrEqual(const std::uint32_t *number, const std::uint32_t *other, int limbs);
+    static int bitLength(const Number &number);
+};
+
+#endif // LAYOUTCODEC_H
@@ -0,0 +1,658 @@
+/*
+ * Author: Martin Nguyen
+ * Description: Implementation of PatternDatabase class for Minesweeper game
+ * Date: 10/19/2026
+ */
+
+#include "PatternDatabase.h"
+
+// System/standard libraries
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <random>
+
+namespace {
+
+// Keys are below 11^9 * 3^16 < 2^57; the top 7 bits of a key word hold the low bits of the
+// slot's value. All 57 key bits set marks an unused slot.
+constexpr int KEY_BITS = 57;
+constexpr std::uint64_t KEY_MASK = (1ull << KEY_BITS) - 1;
+constexpr std::uint64_t EMPTY_KEY = KEY_MASK;
+
+// File header
+constexpr char FILE_MAGIC[4] = { 'M', 'S', 'P', 'D' };
+constexpr std::uint32_t FILE_VERSION = 2;
+constexpr std::streamoff FILE_HEADER_SIZE = 4 + 4 * sizeof(std::uint32_t);
+
+// Displacements a bucket tries before the table is rebuilt with more slots (they're stored as u16)
+constexpr std::uint32_t MAX_DISPLACEMENT = 1u << 16;
+
+// The centre square is the revealed number, so it's never forced and has no digit in a value
+constexpr int CENTRE = PatternDatabase::CELLS / 2;
+
+// Largest number of hidden squares a window may have for enumeration
+constexpr int MAX_VARIABLES = 24;
+
+// Boards the generator plays on: beginner, intermediate and expert density
+struct BoardSize {
+    int width;
+    int height;
+    int mines;
+};
+constexpr BoardSize GENERATOR_BOARDS[] = { { 9, 9, 10 }, { 16, 16, 40 }, { 30, 16, 99 } };
+
+std::uint64_t mix(std::uint64_t x)
+{
+    // splitmix64 finaliser
+    x += 0x9E3779B97F4A7C15ull;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ull;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBull;
+    return x ^ (x >> 31);
+}
+
+/*
+ * Function: packMasks
+ * Description: Packs a window's forced squares as 24 base-3 digits (0 free, 1 safe, 2 mine),
+ *              which fit in 39 bits
+ * Parameters: safeMask - Forced safe squares, mineMask - Forced mines
+ * Returns: The packed value
+ */
+std::uint64_t packMasks(std::uint32_t safeMask, std::uint32_t mineMask)
+{
+    std::uint64_t value = 0;
+    for (int i = PatternDatabase::CELLS - 1; i >= 0; --i)
+    {
+        if (i != CENTRE)
+            value = value * 3 + ((safeMask >> i) & 1) + 2 * ((mineMask >> i) & 1);
+    }
+    return value;
+}
+
+/*
+ * Function: unpackMasks
+ * Description: Undoes packMasks
+ * Parameters: value - The packed value, safeMask - Set to the forced safe squares,
+ *             mineMask - Set to the forced mines
+ */
+void unpackMasks(std::uint64_t value, std::uint32_t &safeMask, std::uint32_t &mineMask)
+{
+    safeMask = 0;
+    mineMask = 0;
+    for (int i = 0; i < PatternDatabase::CELLS; ++i)
+    {
+        if (i == CENTRE)
+            continue;
+        std::uint64_t digit = value % 3;
+        value /= 3;
+        if (digit == 1)
+            safeMask |= 1u << i;
+        else if (digit == 2)
+            mineMask |= 1u << i;
+    }
+}
+
+int countBits(std::uint32_t bits)
+{
+    int count = 0;
+    for (; bits != 0; bits &= bits - 1)
+        ++count;
+    return count;
+}
+
+bool isInner(int index)
+{
+    int r = index / PatternDatabase::WINDOW;
+    int c = index % PatternDatabase::WINDOW;
+    return r >= 1 && r <= 3 && c >= 1 && c <= 3;
+}
+
+// SYMMETRY.map[t][i] is where window square i lands under rotation/reflection t;
+// SYMMETRY.weight[t][i] is what square i's digit is worth in the key of that orientation
+struct SymmetryTable {
+    int map[8][PatternDatabase::CELLS];
+    std::uint64_t weight[8][PatternDatabase::CELLS];
+    SymmetryTable()
+    {
+        const int n = PatternDatabase::WINDOW - 1;
+        for (int r = 0; r <= n; ++r)
+        {
+            for (int c = 0; c <= n; ++c)
+            {
+                const int targets[8][2] = { { r, c }, { c, n - r }, { n - r, n - c }, { n - c, r },
+                                            { r, n - c }, { c, r }, { n - r, c }, { n - c, n - r } };
+                for (int t = 0; t < 8; ++t)
+                    map[t][r * (n + 1) + c] = targets[t][0] * (n + 1) + targets[t][1];
+            }
+        }
+
+        // Key digits run from square 0 (most significant) to square 24
+        std::uint64_t positionWeight[PatternDatabase::CELLS];
+        std::uint64_t place = 1;
+        for (int i = PatternDatabase::CELLS - 1; i >= 0; --i)
+        {
+            positionWeight[i] = place;
+            place *= isInner(i) ? 11 : 3;
+        }
+        for (int t = 0; t < 8; ++t)
+            for (int i = 0; i < PatternDatabase::CELLS; ++i)
+                weight[t][i] = positionWeight[map[t][i]];
+    }
+};
+const SymmetryTable SYMMETRY;
+
+} // namespace
+
+/*
+ * Constructor: PatternDatabase
+ * Description: Creates an empty table (use generate or load to fill it)
+ */
+PatternDatabase::PatternDatabase() : entries(0), probes(0), hits(0)
+{
+}
+
+/*
+ * Destructor: PatternDatabase
+ * Description: Destroys the table
+ */
+PatternDatabase::~PatternDatabase()
+{
+}
+
+/*
+ * Function: generate
+ * Description: Builds the table by playing random games and solving every frontier window met
+ *              along the way, so it holds the shapes that actually come up in play.
+ *              Games move on by revealing forced safe squares, or a random square when stuck.
+ * Parameters: games - Number of games to play, seed - Random seed,
+ *             cancel - Checked between games; once set, generating stops (may be nullptr)
+ * Returns: true if the table was built, false (leaving the table as it was) if cancelled
+ */
+bool PatternDatabase::generate(int games, std::uint32_t seed, const std::atomic<bool> *cancel)
+{
+    std::unordered_map<std::uint64_t, std::uint64_t> table;
+    std::mt19937 rng(seed);
+    std::uint8_t cells[CELLS];
+    std::uint8_t canonical[CELLS];
+
+    for (int game = 0; game < games; ++game)
+    {
+        if (cancel != nullptr && cancel->load(std::memory_order_relaxed))
+            return false;
+        const BoardSize &size = GENERATOR_BOARDS[game % 3];
+        GameEngine engine(size.width, size.height, size.mines);
+        engine.setSeed(rng());
+        engine.reveal(size.height / 2, size.width / 2);
+
+        while (engine.getStatus() == GameEngine::Status::Playing)
+        {
+            std::vector<int> safe;
+            for (int row = 0; row < size.height; ++row)
+            {
+                for (int col = 0; col < size.width; ++col)
+                {
+                    const Space &space = engine.getSpace(row, col);
+                    if (!space.getIsRevealed() || space.getAdjacentMines() == 0)
+                        continue;
+
+                    readWindow(engine, row, col, cells);
+                    int symmetry = 0;
+                    std::uint64_t key = canonicalKey(cells, symmetry);
+                    auto found = table.find(key);
+                    if (found == table.end())
+                    {
+                        // Solve in canonical orientation so the stored masks need no mapping
+                        std::uint32_t safeMask = 0;
+                        std::uint32_t mineMask = 0;
+                        transform(cells, symmetry, canonical);
+                        solveWindow(canonical, safeMask, mineMask);
+                        found = table.emplace(key, safeMask | (static_cast<std::uint64_t>(mineMask) << 32)).first;
+                    }
+
+                    std::uint32_t safeMask = untransformMask(static_cast<std::uint32_t>(found->second), symmetry);
+                    for (int i = 0; i < CELLS; ++i)
+                        if (safeMask & (1u << i))
+                            safe.push_back((row + i / WINDOW - 2) * size.width + col + i % WINDOW - 2);
+                }
+            }
+
+            if (safe.empty())
+            {
+                // Stuck: guess a random hidden square
+                int index;
+                do
+                    index = static_cast<int>(rng() % static_cast<std::uint32_t>(size.width * size.height));
+                while (engine.getSpace(index / size.width, index % size.width).getIsRevealed());
+                safe.push_back(index);
+            }
+            for (int index : safe)
+                engine.reveal(index / size.width, index % size.width);
+        }
+    }
+    build(table);
+    return true;
+}
+
+/*
+ * Function: save
+ * Description: Writes the table to a binary file
+ * Parameters: path - File to write
+ * Returns: true on success, false otherwise
+ */
+bool PatternDatabase::save(const std::string &path) const
+{
+    std::ofstream file(path, std::ios::binary);
+    if (!file)
+        return false;
+    std::uint32_t header[4] = { FILE_VERSION, static_cast<std::uint32_t>(entries),
+                                static_cast<std::uint32_t>(displacements.size()), static_cast<std::uint32_t>(keys.size()) };
+    file.write(FILE_MAGIC, sizeof(FILE_MAGIC));
+    file.write(reinterpret_cast<const char *>(header), sizeof(header));
+    file.write(reinterpret_cast<const char *>(displacements.data()), displacements.size() * sizeof(std::uint16_t));
+    file.write(reinterpret_cast<const char *>(keys.data()), keys.size() * sizeof(std::uint64_t));
+    file.write(reinterpret_cast<const char *>(values.data()), values.size() * sizeof(std::uint32_t));
+    return static_cast<bool>(file);
+}
+
+/*
+ * Function: load
+ * Description: Reads a table written by save
+ * Parameters: path - File to read
+ * Returns: true on success, false if the file is missing or not a pattern table
+ */
+bool PatternDatabase::load(const std::string &path)
+{
+    std::ifstream file(path, std::ios::binary);
+    char magic[4];
+    std::uint32_t header[4];
+    if (!file.read(magic, sizeof(magic)) || std::memcmp(magic, FILE_MAGIC, sizeof(magic)) != 0 ||
+        !file.read(reinterpret_cast<char *>(header), sizeof(header)) || header[0] != FILE_VERSION)
+        return false;
+
+    // The counts must describe exactly the rest of the file before anything is allocated
+    file.seekg(0, std::ios::end);
+    std::streamoff fileSize = file.tellg();
+    file.seekg(FILE_HEADER_SIZE);
+    std::streamoff expected = FILE_HEADER_SIZE + static_cast<std::streamoff>(header[2]) * sizeof(std::uint16_t) +
+                              static_cast<std::streamoff>(header[3]) * (sizeof(std::uint64_t) + sizeof(std::uint32_t));
+    if (!file || fileSize != expected || header[2] == 0 || header[3] == 0 || header[1] > header[3])
+        return false;
+
+    std::vector<std::uint16_t> newDisplacements(header[2]);
+    std::vector<std::uint64_t> newKeys(header[3]);
+    std::vector<std::uint32_t> newValues(header[3]);
+    file.read(reinterpret_cast<char *>(newDisplacements.data()), newDisplacements.size() * sizeof(std::uint16_t));
+    file.read(reinterpret_cast<char *>(newKeys.data()), newKeys.size() * sizeof(std::uint64_t));
+    file.read(reinterpret_cast<char *>(newValues.data()), newValues.size() * sizeof(std::uint32_t));
+    if (!file)
+        return false;
+
+    entries = header[1];
+    displacements.swap(newDisplacements);
+    keys.swap(newKeys);
+    values.swap(newValues);
+    resetCounters();
+    return true;
+}
+
+/*
+ * Function: loadOrGenerate
+ * Description: Loads the table, or on first run generates it and saves it for next time
+ * Parameters: path - Table file, games - Games to play if it has to be generated,
+ *             cancel - Stops generating once set (may be nullptr)
+ * Returns: true if the table came from the file, false if it was generated (or cancelled)
+ */
+bool PatternDatabase::loadOrGenerate(const std::string &path, int games, const std::atomic<bool> *cancel)
+{
+    if (load(path))
+        return true;
+    if (generate(games, 1, cancel) && !save(path))
+        std::cerr << "PatternDatabase: cannot save " << path << ", the table will be generated again next time" << std::endl;
+    return false;
+}
+
+/*
+ * Function: probe
+ * Description: Looks up the forced squares for a window
+ * Parameters: cells - The window (see readWindow), safeMask - Set to the forced safe squares,
+ *             mineMask - Set to the forced mines
+ * Returns: true if the window's shape is in the table, false if it has to be solved
+ */
+bool PatternDatabase::probe(const std::uint8_t cells[CELLS], std::uint32_t &safeMask, std::uint32_t &mineMask) const
+{
+    probes.fetch_add(1, std::memory_order_relaxed);
+    if (keys.empty())
+        return false;
+
+    int symmetry = 0;
+    std::uint64_t key = canonicalKey(cells, symmetry);
+    size_t slot = slotFor(key);
+    if ((keys[slot] & KEY_MASK) != key)
+        return false;
+
+    hits.fetch_add(1, std::memory_order_relaxed);
+    std::uint32_t canonicalSafe = 0;
+    std::uint32_t canonicalMines = 0;
+    unpackMasks((keys[slot] >> KEY_BITS) | (static_cast<std::uint64_t>(values[slot]) << (64 - KEY_BITS)),
+                canonicalSafe, canonicalMines);
+    safeMask = untransformMask(canonicalSafe, symmetry);
+    mineMask = untransformMask(canonicalMines, symmetry);
+    return true;
+}
+
+/*
+ * Function: size
+ * Description: Gets the number of patterns in the table
+ * Returns: Number of patterns
+ */
+size_t PatternDatabase::size() const
+{
+    return entries;
+}
+
+/*
+ * Function: getProbes
+ * Description: Gets the number of lookups since the last reset
+ * Returns: Number of probes
+ */
+std::uint64_t PatternDatabase::getProbes() const
+{
+    return probes.load(std::memory_order_relaxed);
+}
+
+/*
+ * Function: getHits
+ * Description: Gets the number of lookups that found their pattern since the last reset
+ * Returns: Number of hits
+ */
+std::uint64_t PatternDatabase::getHits() const
+{
+    return hits.load(std::memory_order_relaxed);
+}
+
+/*
+ * Function: getHitRate
+ * Description: Gets the share of lookups that found their pattern
+ * Returns: Hits divided by probes (0 if nothing was probed)
+ */
+double PatternDatabase::getHitRate() const
+{
+    std::uint64_t total = getProbes();
+    return total == 0 ? 0.0 : static_cast<double>(getHits()) / static_cast<double>(total);
+}
+
+/*
+ * Function: resetCounters
+ * Description: Sets the probe and hit counters back to zero
+ */
+void PatternDatabase::resetCounters()
+{
+    probes.store(0, std::memory_order_relaxed);
+    hits.store(0, std::memory_order_relaxed);
+}
+
+/*
+ * Function: readWindow
+ * Description: Reads the 5x5 window around a square as the player sees it
+ * Parameters: engine - The game, row - Centre row, col - Centre column, cells - Filled with the window
+ */
+void PatternDatabase::readWindow(const GameEngine &engine, int row, int col, std::uint8_t cells[CELLS])
+{
+    for (int dr = -2; dr <= 2; ++dr)
+    {
+        for (int dc = -2; dc <= 2; ++dc)
+        {
+            std::uint8_t &cell = cells[(dr + 2) * WINDOW + dc + 2];
+            if (!engine.isInside(row + dr, col + dc))
+            {
+                cell = WALL;
+                continue;
+            }
+            const Space &space = engine.getSpace(row + dr, col + dc);
+            cell = space.getIsRevealed() ? static_cast<std::uint8_t>(NUMBER + space.getAdjacentMines()) : HIDDEN;
+        }
+    }
+}
+
+/*
+ * Function: solveWindow
+ * Description: Finds the hidden squares that are a mine in every arrangement that fits the
+ *              numbers in the centre 3x3 (and those that are a mine in none), by backtracking
+ * Parameters: cells - The window, safeMask - Set to the forced safe squares,
+ *             mineMask - Set to the forced mines
+ * Returns: true if the window was small enough to solve
+ */
+bool PatternDatabase::solveWindow(const std::uint8_t cells[CELLS], std::uint32_t &safeMask, std::uint32_t &mineMask)
+{
+    safeMask = 0;
+    mineMask = 0;
+
+    // Constraints: the revealed numbers in the centre 3x3 and their hidden neighbours
+    struct Constraint {
+        int target;
+        std::uint32_t neighbours;
+    };
+    Constraint constraints[9];
+    int constraintCount = 0;
+    std::uint32_t variables = 0;
+    for (int i = 0; i < CELLS; ++i)
+    {
+        if (!isInner(i) || cells[i] == HIDDEN || cells[i] == WALL)
+            continue;
+        Constraint &constraint = constraints[constraintCount++];
+        constraint.target = cells[i] - NUMBER;
+        constraint.neighbours = 0;
+        for (int dr = -1; dr <= 1; ++dr)
+            for (int dc = -1; dc <= 1; ++dc)
+            {
+                int n = i + dr * WINDOW + dc;
+                if ((dr != 0 || dc != 0) && cells[n] == HIDDEN)
+                    constraint.neighbours |= 1u << n;
+            }
+        variables |= constraint.neighbours;
+    }
+
+    int order[CELLS];
+    int variableCount = 0;
+    for (int i = 0; i < CELLS; ++i)
+        if (variables & (1u << i))
+            order[variableCount++] = i;
+    if (variableCount == 0 || variableCount > MAX_VARIABLES)
+        return variableCount == 0;
+
+    // Depth-first over the variables; a constraint fails once it has too many mines
+    // or too few undecided neighbours left to reach its number
+    std::uint32_t alwaysMine = variables;
+    std::uint32_t alwaysSafe = variables;
+    bool anySolution = false;
+    std::uint32_t stackMines[CELLS + 1];
+    int stackChoice[CELLS + 1];
+    int depth = 0;
+    stackMines[0] = 0;
+    stackChoice[0] = -1;
+    while (depth >= 0)
+    {
+        if (++stackChoice[depth] > 1)
+        {
+            --depth;
+            continue;
+        }
+        std::uint32_t mines = stackMines[depth] | (stackChoice[depth] ? (1u << order[depth]) : 0u);
+        std::uint32_t decided = (depth + 1 < variableCount) ? ((1u << order[depth + 1]) - 1) & variables : variables;
+
+        bool consistent = true;
+        for (int k = 0; k < constraintCount && consistent; ++k)
+        {
+            int placed = countBits(mines & constraints[k].neighbours);
+            int open = countBits(constraints[k].neighbours & ~decided);
+            consistent = placed <= constraints[k].target && placed + open >= constraints[k].target;
+        }
+        if (!consistent)
+            continue;
+
+        if (depth + 1 == variableCount)
+        {
+            anySolution = true;
+            alwaysMine &= mines;
+            alwaysSafe &= ~mines;
+            continue;
+        }
+        ++depth;
+        stackMines[depth] = mines;
+        stackChoice[depth] = -1;
+    }
+
+    if (anySolution)
+    {
+        safeMask = alwaysSafe;
+        mineMask = alwaysMine;
+    }
+    return true;
+}
+
+/*
+ * Function: canonicalKey
+ * Description: Encodes a window in the orientation with the smallest key
+ * Parameters: cells - The window, symmetry - Set to the rotation/reflection that was used
+ * Returns: The canonical key
+ */
+std::uint64_t PatternDatabase::canonicalKey(const std::uint8_t cells[CELLS], int &symmetry)
+{
+    // Every orientation's key is a weighted sum of the same digits, so no window is moved
+    std::uint64_t digits[CELLS];
+    for (int i = 0; i < CELLS; ++i)
+        digits[i] = isInner(i) ? cells[i] : (cells[i] == HIDDEN ? 0 : cells[i] == WALL ? 2 : 1);
+
+    std::uint64_t best = ~0ull;
+    symmetry = 0;
+    for (int t = 0; t < 8; ++t)
+    {
+        std::uint64_t key = 0;
+        for (int i = 0; i < CELLS; ++i)
+            key += digits[i] * SYMMETRY.weight[t][i];
+        if (key < best)
+        {
+            best = key;
+            symmetry = t;
+        }
+    }
+    return best;
+}
+
+/*
+ * Function: build
+ * Description: Lays the patterns out as a perfect hash (hash and displace): buckets are placed
+ *              largest first, each trying displacements until all its keys land in free slots.
+ *              If a bucket runs out of displacements, it starts over with more slots.
+ * Parameters: table - Canonical key to packed masks
+ */
+void PatternDatabase::build(const std::unordered_map<std::uint64_t, std::uint64_t> &table)
+{
+    entries = table.size();
+    size_t bucketCount = entries / 4 + 1;
+    std::vector<std::vector<std::uint64_t>> buckets(bucketCount);
+    for (const auto &entry : table)
+        buckets[mix(entry.first) % bucketCount].push_back(entry.first);
+    std::vector<size_t> order(bucketCount);
+    for (size_t b = 0; b < bucketCount; ++b)
+        order[b] = b;
+    std::sort(order.begin(), order.end(), [&](size_t a, size_t b) { return buckets[a].size() > buckets[b].size(); });
+
+    size_t slotCount = entries + entries / 32 + 1; // about 97% full
+    while (!place(table, buckets, order, slotCount))
+        slotCount += slotCount / 8 + 1;
+    resetCounters();
+}
+
+/*
+ * Function: place
+ * Description: Tries to place every bucket in a table of the given size
+ * Parameters: table - Canonical key to packed masks, buckets - Keys by bucket,
+ *             order - Buckets in placement order, slotCount - Number of slots
+ * Returns: true if every bucket found a displacement below MAX_DISPLACEMENT
+ */
+bool PatternDatabase::place(const std::unordered_map<std::uint64_t, std::uint64_t> &table,
+                            const std::vector<std::vector<std::uint64_t>> &buckets, const std::vector<size_t> &order,
+                            size_t slotCount)
+{
+    displacements.assign(buckets.size(), 0);
+    keys.assign(slotCount, EMPTY_KEY);
+    values.assign(slotCount, 0);
+
+    std::vector<size_t> slots;
+    for (size_t b : order)
+    {
+        const std::vector<std::uint64_t> &bucket = buckets[b];
+        if (bucket.empty())
+            break;
+        for (std::uint32_t d = 1; ; ++d)
+        {
+            if (d == MAX_DISPLACEMENT)
+                return false;
+            displacements[b] = static_cast<std::uint16_t>(d);
+            slots.clear();
+            bool fits = true;
+            for (std::uint64_t key : bucket)
+            {
+                size_t slot = slotFor(key);
+                if (keys[slot] != EMPTY_KEY || std::find(slots.begin(), slots.end(), slot) != slots.end())
+                {
+                    fits = false;
+                    break;
+                }
+                slots.push_back(slot);
+            }
+            if (!fits)
+                continue;
+            for (size_t k = 0; k < bucket.size(); ++k)
+            {
+                std::uint64_t masks = table.at(bucket[k]);
+                std::uint64_t value = packMasks(static_cast<std::uint32_t>(masks), static_cast<std::uint32_t>(masks >> 32));
+                keys[slots[k]] = bucket[k] | (value << KEY_BITS);
+                values[slots[k]] = static_cast<std::uint32_t>(value >> (64 - KEY_BITS));
+            }
+            break;
+        }
+    }
+    return true;
+}
+
+/*
+ * Function: slotFor
+ * Description: Gets the slot a key hashes to under its bucket's displacement
+ * Parameters: key - Canonical key
+ * Returns: Slot index
+ */
+size_t PatternDatabase::slotFor(std::uint64_t key) const
+{
+    std::uint64_t hash = mix(key);
+    std::uint32_t displacement = displacements[hash % displacements.size()];
+    return mix(hash ^ (displacement * 0xD6E8FEB86659FD93ull)) % keys.size();
+}
+
+/*
+ * Function: transform
+ * Description: Rotates/reflects a window
+ * Parameters: cells - The window, symmetry - Which of the 8 symmetries, out - The moved window
+ */
+void PatternDatabase::transform(const std::uint8_t cells[CELLS], int symmetry, std::uint8_t out[CELLS])
+{
+    for (int i = 0; i < CELLS; ++i)
+        out[SYMMETRY.map[symmetry][i]] = cells[i];
+}
+
+/*
+ * Function: untransformMask
+ * Description: Maps a mask from canonical orientation back onto the original window
+ * Parameters: mask - Mask in canonical orientation, symmetry - The symmetry used to get there
+ * Returns: Mask in the original orientation
+ */
+std::uint32_t PatternDatabase::untransformMask(std::uint32_t mask, int symmetry)
+{
+    std::uint32_t result = 0;
+    for (int i = 0; i < CELLS; ++i)
+        if (mask & (1u << SYMMETRY.map[symmetry][i]))
+            result |= 1u << i;
+    return result;
+}
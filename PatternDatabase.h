@@ -0,0 +1,88 @@
+/*
+ * Author: Martin Nguyen
+ * Description: PatternDatabase class, precomputed deductions for local board shapes
+ * Date: 10/19/2026
+ *
+ * A pattern is the 5x5 window around a revealed number. The centre 3x3 keeps exact
+ * numbers (those are the constraints, and their neighbours all fit in the window);
+ * the outer ring only keeps hidden / revealed / wall. Windows are folded over the 8
+ * rotations and reflections to one canonical key, and each key maps to the squares
+ * of the window that are forced safe or forced mines (possibly none). Flags are
+ * treated as hidden, so results never depend on the player's marks being right.
+ *
+ * The table is a perfect hash: a bucket's displacement picks the slot, so a probe
+ * is one hash, one displacement read and one key compare. A slot is 12 bytes: the
+ * 57-bit key, and the forced squares as 24 base-3 digits (39 bits) split across the
+ * key word's spare bits and a 32-bit word.
+ */
+
+#ifndef PATTERNDATABASE_H
+#define PATTERNDATABASE_H
+
+// System/standard libraries
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "GameEngine.h"
+
+class PatternDatabase {
+public:
+    // Window geometry: bit (dr + 2) * WINDOW + (dc + 2) of a mask is the square at (row + dr, col + dc)
+    static constexpr int WINDOW = 5;
+    static constexpr int CELLS = WINDOW * WINDOW;
+
+    // Window cell values: HIDDEN, NUMBER + n for a revealed n, or WALL off the board
+    static constexpr std::uint8_t HIDDEN = 0;
+    static constexpr std::uint8_t NUMBER = 1;
+    static constexpr std::uint8_t WALL = 10;
+
+    // Games played to build the table when there is no saved one
+    static constexpr int DEFAULT_GAMES = 3000;
+
+    // Constructor and destructor
+    PatternDatabase();
+    virtual ~PatternDatabase();
+
+    // Building and storing the table
+    bool generate(int games, std::uint32_t seed, const std::atomic<bool> *cancel = nullptr);
+    bool save(const std::string &path) const;
+    bool load(const std::string &path);
+    bool loadOrGenerate(const std::string &path, int games = DEFAULT_GAMES, const std::atomic<bool> *cancel = nullptr);
+
+    // Lookup (masks are in window coordinates)
+    bool probe(const std::uint8_t cells[CELLS], std::uint32_t &safeMask, std::uint32_t &mineMask) const;
+    size_t size() const;
+
+    // Hit-rate counter
+    std::uint64_t getProbes() const;
+    std::uint64_t getHits() const;
+    double getHitRate() const;
+    void resetCounters();
+
+    // Window helpers, shared with the solver
+    static void readWindow(const GameEngine &engine, int row, int col, std::uint8_t cells[CELLS]);
+    static bool solveWindow(const std::uint8_t cells[CELLS], std::uint32_t &safeMask, std::uint32_t &mineMask);
+    static std::uint64_t canonicalKey(const std::uint8_t cells[CELLS], int &symmetry);
+
+private:
+    // Instance variables
+    size_t entries;
+    std::vector<std::uint16_t> displacements; // one per bucket
+    std::vector<std::uint64_t> keys;          // key | low 7 bits of the packed masks << 57
+    std::vector<std::uint32_t> values;        // rest of the packed masks, canonical orientation
+    mutable std::atomic<std::uint64_t> probes;
+    mutable std::atomic<std::uint64_t> hits;
+
+    // Private functions
+    void build(const std::unordered_map<std::uint64_t, std::uint64_t> &table);
+    bool place(const std::unordered_map<std::uint64_t, std::uint64_t> &table,
+               const std::vector<std::vector<std::uint64_t>> &buckets, const std::vector<size_t> &order, size_t slotCount);
+    size_t slotFor(std::uint64_t key) const;
+    static void transform(const std::uint8_t cells[CELLS], int symmetry, std::uint8_t out[CELLS]);
+    static std::uint32_t untransformMask(std::uint32_t mask, int symmetry);
+};
+
+#endif // PATTERNDATABASE_H
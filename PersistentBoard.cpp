@@ -0,0 +1,153 @@
+/*
+ * Author: Martin Nguyen
+ * Description: Implementation of PersistentBoard class for Minesweeper game
+ * Date: 10/19/2026
+ */
+
+#include "PersistentBoard.h"
+
+/*
+ * Constructor: PersistentBoard
+ * Description: Creates a board of blank spaces. Every leaf starts out as the same shared blank chunk.
+ * Parameters: cells - Number of spaces on the board
+ */
+PersistentBoard::PersistentBoard(int cells) : cells(cells), depth(1)
+{
+    int leafCount = (cells + LEAF_SIZE - 1) / LEAF_SIZE;
+    setDepth(leafCount);
+    root = build(depth, 0, leafCount, std::make_shared<Leaf>(), nullptr);
+}
+
+/*
+ * Constructor: PersistentBoard
+ * Description: Creates a board holding copies of the given spaces, filling each chunk once
+ *              (much cheaper than editing the spaces in one at a time)
+ * Parameters: spaces - The spaces, row-major
+ */
+PersistentBoard::PersistentBoard(const std::vector<Space> &spaces) : cells(static_cast<int>(spaces.size())), depth(1)
+{
+    int leafCount = (cells + LEAF_SIZE - 1) / LEAF_SIZE;
+    setDepth(leafCount);
+    root = build(depth, 0, leafCount, nullptr, &spaces);
+}
+
+/*
+ * Destructor: PersistentBoard
+ * Description: Destroys the board (chunks are freed when no other copy uses them)
+ */
+PersistentBoard::~PersistentBoard()
+{
+}
+
+/*
+ * Function: get
+ * Description: Gets a read-only reference to a space
+ * Parameters: index - Cell index (row * width + col)
+ * Returns: A reference to the space, valid until this board is next edited
+ */
+const Space &PersistentBoard::get(int index) const
+{
+    return findLeaf(index).cells[index & (LEAF_SIZE - 1)];
+}
+
+/*
+ * Function: edit
+ * Description: Gets a writable reference to a space, first copying any chunk or branch
+ *              on its path that another board copy still shares
+ * Parameters: index - Cell index (row * width + col)
+ * Returns: A reference to the space, valid until this board is next edited
+ */
+Space &PersistentBoard::edit(int index)
+{
+    int leafIndex = index >> LEAF_BITS;
+    if (root.use_count() > 1)
+        root = std::make_shared<Branch>(*root);
+    Branch *branch = root.get();
+    for (int level = depth; ; --level)
+    {
+        std::shared_ptr<void> &child = branch->children[(leafIndex >> (BRANCH_BITS * (level - 1))) & (BRANCH_SIZE - 1)];
+        if (level == 1)
+        {
+            if (child.use_count() > 1)
+                child = std::make_shared<Leaf>(*static_cast<const Leaf *>(child.get()));
+            return static_cast<Leaf *>(child.get())->cells[index & (LEAF_SIZE - 1)];
+        }
+        if (child.use_count() > 1)
+            child = std::make_shared<Branch>(*static_cast<const Branch *>(child.get()));
+        branch = static_cast<Branch *>(child.get());
+    }
+}
+
+/*
+ * Function: size
+ * Description: Gets the number of spaces on the board
+ * Returns: Number of spaces
+ */
+int PersistentBoard::size() const
+{
+    return cells;
+}
+
+/*
+ * Function: setDepth
+ * Description: Picks the number of branch levels needed to reach every leaf
+ * Parameters: leafCount - Number of leaves
+ */
+void PersistentBoard::setDepth(int leafCount)
+{
+    depth = 1;
+    while ((1 << (BRANCH_BITS * depth)) < leafCount)
+        ++depth;
+}
+
+/*
+ * Function: build
+ * Description: Builds the branches for a range of leaves, either all pointing at one blank
+ *              chunk or each filled from a list of spaces
+ * Parameters: level - Branch level (1 = just above the leaves), firstLeaf - First leaf covered,
+ *             leafCount - Total number of leaves, blank - The shared blank chunk (if no spaces),
+ *             spaces - The spaces to fill the leaves with (or nullptr)
+ * Returns: The new branch
+ */
+std::shared_ptr<PersistentBoard::Branch> PersistentBoard::build(int level, int firstLeaf, int leafCount,
+                                                                const std::shared_ptr<Leaf> &blank,
+                                                                const std::vector<Space> *spaces)
+{
+    std::shared_ptr<Branch> branch = std::make_shared<Branch>();
+    int span = 1 << (BRANCH_BITS * (level - 1)); // leaves under each child
+    for (int slot = 0; slot < BRANCH_SIZE && firstLeaf + slot * span < leafCount; ++slot)
+    {
+        if (level > 1)
+        {
+            branch->children[slot] = build(level - 1, firstLeaf + slot * span, leafCount, blank, spaces);
+        }
+        else if (spaces == nullptr)
+        {
+            branch->children[slot] = blank;
+        }
+        else
+        {
+            std::shared_ptr<Leaf> leaf = std::make_shared<Leaf>();
+            size_t first = static_cast<size_t>(firstLeaf + slot) * LEAF_SIZE;
+            for (size_t i = first; i < first + LEAF_SIZE && i < spaces->size(); ++i)
+                leaf->cells[i - first] = (*spaces)[i];
+            branch->children[slot] = leaf;
+        }
+    }
+    return branch;
+}
+
+/*
+ * Function: findLeaf
+ * Description: Walks down the tree to the chunk that holds a space
+ * Parameters: index - Cell index
+ * Returns: The chunk
+ */
+const PersistentBoard::Leaf &PersistentBoard::findLeaf(int index) const
+{
+    int leafIndex = index >> LEAF_BITS;
+    const Branch *node = root.get();
+    for (int level = depth; level > 1; --level)
+        node = static_cast<const Branch *>(node->children[(leafIndex >> (BRANCH_BITS * (level - 1))) & (BRANCH_SIZE - 1)].get());
+    return *static_cast<const Leaf *>(node->children[leafIndex & (BRANCH_SIZE - 1)].get());
+}
@@ -0,0 +1,61 @@
+/*
+ * Author: Martin Nguyen
+ * Description: PersistentBoard class, copy-on-write storage for the spaces of a board
+ * Date: 10/19/2026
+ *
+ * Spaces live in fixed-size leaf chunks under a shallow tree of branches. Copying a
+ * PersistentBoard only copies the root pointer; the copies share every chunk until one
+ * of them edits a space, which then copies just the chunk and the branches above it.
+ * A snapshot therefore costs memory only for the chunks changed after it was taken.
+ * Chunks are shared without locking, so copies must stay on one thread.
+ */
+
+#ifndef PERSISTENTBOARD_H
+#define PERSISTENTBOARD_H
+
+// System/standard libraries
+#include <memory>
+#include <vector>
+
+#include "Space.h"
+
+class PersistentBoard {
+public:
+    // Chunk geometry: 16 spaces per leaf, 32 children per branch
+    static constexpr int LEAF_BITS = 4;
+    static constexpr int BRANCH_BITS = 5;
+    static constexpr int LEAF_SIZE = 1 << LEAF_BITS;
+    static constexpr int BRANCH_SIZE = 1 << BRANCH_BITS;
+
+    // Constructor and destructor
+    PersistentBoard(int cells = 0);
+    PersistentBoard(const std::vector<Space> &spaces);
+    virtual ~PersistentBoard();
+
+    // Public functions
+    const Space& get(int index) const;
+    Space& edit(int index);
+    int size() const;
+
+private:
+    // Tree nodes
+    struct Leaf {
+        Space cells[LEAF_SIZE];
+    };
+    struct Branch {
+        std::shared_ptr<void> children[BRANCH_SIZE]; // Leafs on the lowest level, Branches above it
+    };
+
+    // Instance variables
+    int cells;
+    int depth; // number of branch levels above the leaves
+    std::shared_ptr<Branch> root;
+
+    // Private functions
+    void setDepth(int leafCount);
+    std::shared_ptr<Branch> build(int level, int firstLeaf, int leafCount, const std::shared_ptr<Leaf> &blank,
+                                  const std::vector<Space> *spaces);
+    const Leaf& findLeaf(int index) const;
+};
+
+#endif // PERSISTENTBOARD_H
@@ -0,0 +1,126 @@
+/*
+ * Author: Martin Nguyen
+ * Description: Implementation of Solver class for Minesweeper game
+ * Date: 10/19/2026
+ */
+
+#include "Solver.h"
+
+/*
+ * Constructor: Solver
+ * Description: Creates a solver, optionally backed by a pattern table
+ * Parameters: patterns - Pattern table to try before enumerating (may be nullptr)
+ */
+Solver::Solver(const PatternDatabase *patterns) : patterns(patterns)
+{
+}
+
+/*
+ * Destructor: Solver
+ * Description: Destroys the solver (the pattern table is not owned)
+ */
+Solver::~Solver()
+{
+}
+
+/*
+ * Function: findForcedMoves
+ * Description: Checks the window around every revealed number on the frontier and collects
+ *              the hidden squares that must be safe and those that must be mines
+ * Parameters: engine - The game, safe - Filled with forced safe cells, mines - Filled with forced mines
+ * Returns: true if anything was found
+ */
+bool Solver::findForcedMoves(const GameEngine &engine, std::vector<int> &safe, std::vector<int> &mines)
+{
+    const int width = engine.getWidth();
+    std::vector<std::uint8_t> found(static_cast<size_t>(width) * engine.getHeight(), 0);
+    safe.clear();
+    mines.clear();
+
+    for (int row = 0; row < engine.getHeight(); ++row)
+    {
+        for (int col = 0; col < width; ++col)
+        {
+            if (!isFrontier(engine, row, col))
+                continue;
+            std::uint32_t safeMask = 0;
+            std::uint32_t mineMask = 0;
+            checkWindow(engine, row, col, safeMask, mineMask);
+
+            for (int i = 0; i < PatternDatabase::CELLS; ++i)
+            {
+                if (!((safeMask | mineMask) & (1u << i)))
+                    continue;
+                int index = (row + i / PatternDatabase::WINDOW - 2) * width + col + i % PatternDatabase::WINDOW - 2;
+                if (found[index])
+                    continue;
+                found[index] = 1;
+                if (safeMask & (1u << i))
+                    safe.push_back(index);
+                else
+                    mines.push_back(index);
+            }
+        }
+    }
+    return !safe.empty() || !mines.empty();
+}
+
+/*
+ * Function: isForcedSafe
+ * Description: Checks if a hidden square is certainly safe, looking only at the numbers around it
+ * Parameters: engine - The game, row - The row of the square, col - The column of the square
+ * Returns: true if some nearby number proves the square safe
+ */
+bool Solver::isForcedSafe(const GameEngine &engine, int row, int col)
+{
+    for (int dr = -1; dr <= 1; ++dr)
+    {
+        for (int dc = -1; dc <= 1; ++dc)
+        {
+            if (!isFrontier(engine, row + dr, col + dc))
+                continue;
+            std::uint32_t safeMask = 0;
+            std::uint32_t mineMask = 0;
+            checkWindow(engine, row + dr, col + dc, safeMask, mineMask);
+            if (safeMask & (1u << ((2 - dr) * PatternDatabase::WINDOW + 2 - dc)))
+                return true;
+        }
+    }
+    return false;
+}
+
+/*
+ * Function: isFrontier
+ * Description: Checks if a square is a revealed number with a hidden neighbour
+ * Parameters: engine - The game, row - The row of the square, col - The column of the square
+ * Returns: true if the square is on the frontier
+ */
+bool Solver::isFrontier(const GameEngine &engine, int row, int col) const
+{
+    if (!engine.isInside(row, col))
+        return false;
+    const Space &space = engine.getSpace(row, col);
+    if (!space.getIsRevealed() || space.getAdjacentMines() == 0)
+        return false;
+    for (int dr = -1; dr <= 1; ++dr)
+        for (int dc = -1; dc <= 1; ++dc)
+            if (engine.isInside(row + dr, col + dc) && !engine.getSpace(row + dr, col + dc).getIsRevealed())
+                return true;
+    return false;
+}
+
+/*
+ * Function: checkWindow
+ * Description: Gets the forced squares around a frontier number: one table probe, and
+ *              enumeration only when the shape isn't in the table
+ * Parameters: engine - The game, row - Centre row, col - Centre column,
+ *             safeMask - Set to the forced safe squares, mineMask - Set to the forced mines
+ */
+void Solver::checkWindow(const GameEngine &engine, int row, int col, std::uint32_t &safeMask, std::uint32_t &mineMask)
+{
+    std::uint8_t cells[PatternDatabase::CELLS];
+    PatternDatabase::readWindow(engine, row, col, cells);
+    if (patterns && patterns->probe(cells, safeMask, mineMask))
+        return;
+    PatternDatabase::solveWindow(cells, safeMask, mineMask);
+}
@@ -0,0 +1,42 @@
+/*
+ * Author: Martin Nguyen
+ * Description: Solver class, finds squares that are certainly safe or certainly mines
+ * Date: 10/19/2026
+ *
+ * Hypotheses ("this square is a mine") are tried by enumerating the window around a
+ * number, not by playing moves in a GameEngine what-if branch. A move in the engine
+ * reads the real mines, so a solver that tested guesses that way would be peeking at
+ * the answer; what-if branches are for exploring real moves (analysis mode in the
+ * server, undo and redo in the app), not for deduction.
+ */
+
+#ifndef SOLVER_H
+#define SOLVER_H
+
+// System/standard libraries
+#include <cstdint>
+#include <vector>
+
+#include "GameEngine.h"
+#include "PatternDatabase.h"
+
+class Solver {
+public:
+    // Constructor and destructor
+    Solver(const PatternDatabase *patterns = nullptr);
+    virtual ~Solver();
+
+    // Public functions
+    bool findForcedMoves(const GameEngine &engine, std::vector<int> &safe, std::vector<int> &mines);
+    bool isForcedSafe(const GameEngine &engine, int row, int col);
+
+private:
+    // Instance variables
+    const PatternDatabase *patterns; // optional; looked up (and counted) before enumerating a window
+
+    // Private functions
+    bool isFrontier(const GameEngine &engine, int row, int col) const;
+    void checkWindow(const GameEngine &engine, int row, int col, std::uint32_t &safeMask, std::uint32_t &mineMask);
+};
+
+#endif // SOLVER_H
@@ -0,0 +1,256 @@
+/*
+ * Author: Martin Nguyen
+ * Description: Implementation of the StatsReader class for Minesweeper game
+ * Date: 10/19/2026
+ */
+
+#include "StatsReader.h"
+#include "StatsWriter.h"
+
+// System/standard libraries
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+
+// Little-endian helpers for the file format
+std::uint32_t readU32(const std::uint8_t *p)
+{
+    return static_cast<std::uint32_t>(p[0]) | (static_cast<std::uint32_t>(p[1]) << 8) |
+           (static_cast<std::uint32_t>(p[2]) << 16) | (static_cast<std::uint32_t>(p[3]) << 24);
+}
+
+std::uint64_t readU64(const std::uint8_t *p)
+{
+    return readU32(p) | (static_cast<std::uint64_t>(readU32(p + 4)) << 32);
+}
+
+size_t padded(size_t size)
+{
+    return (size + StatsWriter::BLOCK_ALIGN - 1) / StatsWriter::BLOCK_ALIGN * StatsWriter::BLOCK_ALIGN;
+}
+
+} // namespace
+
+/*
+ * Constructor: StatsReader
+ * Description: Creates a reader with no file open
+ */
+StatsReader::StatsReader() : data(nullptr), size(0), rows(0)
+{
+}
+
+/*
+ * Destructor: StatsReader
+ * Description: Unmaps the file
+ */
+StatsReader::~StatsReader()
+{
+    close();
+}
+
+/*
+ * Function: open
+ * Description: Maps a statistics file and reads its chunk directories. A torn chunk at the
+ *              end (from a writer that crashed) is ignored.
+ * Parameters: path - The file
+ * Returns: true on success, false if the file can't be read or isn't a statistics file
+ */
+bool StatsReader::open(const std::string &path)
+{
+    close();
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+        return false;
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size < StatsWriter::FILE_HEADER_SIZE)
+    {
+        ::close(fd);
+        return false;
+    }
+    size = static_cast<size_t>(info.st_size);
+    void *mapping = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd); // the mapping keeps the file alive
+    if (mapping == MAP_FAILED)
+    {
+        size = 0;
+        return false;
+    }
+    data = static_cast<const std::uint8_t *>(mapping);
+
+    if (readU32(data) != StatsWriter::FILE_MAGIC || readU32(data + 4) != StatsWriter::VERSION ||
+        readU32(data + 8) != GameRecord::COLUMN_COUNT)
+    {
+        close();
+        return false;
+    }
+
+    const size_t directorySize = StatsWriter::CHUNK_HEADER_SIZE + GameRecord::COLUMN_COUNT * StatsWriter::COLUMN_ENTRY_SIZE;
+    size_t pos = StatsWriter::FILE_HEADER_SIZE;
+    while (pos + directorySize <= size && readU32(data + pos) == StatsWriter::CHUNK_MAGIC)
+    {
+        Chunk chunk;
+        chunk.rows = readU32(data + pos + 4);
+        size_t blockPos = pos + directorySize;
+        bool complete = true;
+        for (int column = 0; column < GameRecord::COLUMN_COUNT && complete; ++column)
+        {
+            const std::uint8_t *entry = data + pos + StatsWriter::CHUNK_HEADER_SIZE + column * StatsWriter::COLUMN_ENTRY_SIZE;
+            Block &block = chunk.blocks[column];
+            block.codec = entry[0];
+            block.width = entry[1];
+            block.size = readU32(entry + 4);
+            block.min = readU64(entry + 8);
+            block.max = readU64(entry + 16);
+            block.data = data + blockPos;
+            blockPos += padded(block.size);
+            complete = blockPos <= size;
+        }
+        if (!complete)
+            break;
+        chunks.push_back(chunk);
+        rows += chunk.rows;
+        pos = blockPos;
+    }
+    return true;
+}
+
+/*
+ * Function: close
+ * Description: Unmaps the file
+ */
+void StatsReader::close()
+{
+    if (data != nullptr)
+        munmap(const_cast<std::uint8_t *>(data), size);
+    data = nullptr;
+    size = 0;
+    chunks.clear();
+    rows = 0;
+}
+
+/*
+ * Function: getChunkCount
+ * Description: Gets the number of complete chunks in the file
+ * Returns: Chunk count
+ */
+size_t StatsReader::getChunkCount() const
+{
+    return chunks.size();
+}
+
+/*
+ * Function: getRowCount
+ * Description: Gets the number of records in the file
+ * Returns: Row count
+ */
+std::uint64_t StatsReader::getRowCount() const
+{
+    return rows;
+}
+
+/*
+ * Function: getChunkRange
+ * Description: Gets the smallest and largest value of a column in one chunk (from the directory only)
+ * Parameters: chunk - The chunk, column - The column, min - Set to the smallest value, max - Set to the largest
+ * Returns: true if the chunk and column exist
+ */
+bool StatsReader::getChunkRange(size_t chunk, int column, std::uint64_t &min, std::uint64_t &max) const
+{
+    if (chunk >= chunks.size() || column < 0 || column >= GameRecord::COLUMN_COUNT)
+        return false;
+    min = chunks[chunk].blocks[column].min;
+    max = chunks[chunk].blocks[column].max;
+    return true;
+}
+
+/*
+ * Function: readColumn
+ * Description: Decodes one column of one chunk
+ * Parameters: chunk - The chunk, column - The column, values - Set to the chunk's values
+ * Returns: true on success, false if the chunk or column doesn't exist or the block is damaged
+ */
+bool StatsReader::readColumn(size_t chunk, int column, std::vector<std::uint64_t> &values) const
+{
+    if (chunk >= chunks.size() || column < 0 || column >= GameRecord::COLUMN_COUNT)
+        return false;
+    values.resize(chunks[chunk].rows);
+    return decode(chunks[chunk].blocks[column], chunks[chunk].rows, values.data());
+}
+
+/*
+ * Function: scanColumn
+ * Description: Decodes a column chunk by chunk and hands each chunk's values to a visitor.
+ *              Chunks whose min/max rule out [min, max] are skipped without being read; the
+ *              visitor still gets every row of the chunks that are read, so it does its own filtering.
+ * Parameters: column - The column, visit - Called once per chunk read, min - Lowest value of interest,
+ *             max - Highest value of interest
+ * Returns: Number of rows handed to the visitor
+ */
+std::uint64_t StatsReader::scanColumn(int column, const Visitor &visit, std::uint64_t min, std::uint64_t max) const
+{
+    if (column < 0 || column >= GameRecord::COLUMN_COUNT)
+        return 0;
+    std::vector<std::uint64_t> values;
+    std::uint64_t visited = 0;
+    for (const Chunk &chunk : chunks)
+    {
+        const Block &block = chunk.blocks[column];
+        if (block.max < min || block.min > max)
+            continue;
+        values.resize(chunk.rows);
+        if (!decode(block, chunk.rows, values.data()))
+            continue;
+        visit(values.data(), values.size());
+        visited += chunk.rows;
+    }
+    return visited;
+}
+
+/*
+ * Function: decode
+ * Description: Decodes a column block
+ * Parameters: block - The block, rows - Rows in its chunk, out - Where to put the values
+ * Returns: true on success, false if the block is damaged or uses an unknown codec
+ */
+bool StatsReader::decode(const Block &block, std::uint32_t rows, std::uint64_t *out)
+{
+    const std::uint8_t *p = block.data;
+    const std::uint8_t *end = block.data + block.size;
+    if (block.codec == StatsWriter::CODEC_RAW)
+    {
+        if (block.width < 1 || block.width > 8 || static_cast<std::uint64_t>(rows) * block.width != block.size)
+            return false;
+        for (std::uint32_t row = 0; row < rows; ++row, p += block.width)
+        {
+            std::uint64_t value = 0;
+            for (int i = 0; i < block.width; ++i)
+                value |= static_cast<std::uint64_t>(p[i]) << (8 * i);
+            out[row] = value;
+        }
+        return true;
+    }
+    if (block.codec == StatsWriter::CODEC_DELTA)
+    {
+        std::uint64_t previous = 0;
+        for (std::uint32_t row = 0; row < rows; ++row)
+        {
+            std::uint64_t zigzag = 0;
+            for (int shift = 0; ; shift += 7)
+            {
+                if (p == end || shift > 63)
+                    return false;
+                std::uint8_t byte = *p++;
+                zigzag |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+                if (byte < 0x80)
+                    break;
+            }
+            previous += (zigzag >> 1) ^ (0 - (zigzag & 1));
+            out[row] = previous;
+        }
+        return true;
+    }
+    return false;
+}
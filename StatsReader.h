@@ -0,0 +1,70 @@
+/*
+ * Author: Martin Nguyen
+ * Description: StatsReader class, scans columns of a statistics file written by StatsWriter (POSIX, uses mmap)
+ * Date: 10/19/2026
+ *
+ * Opening the file maps it and reads only the chunk directories. Scanning a column then
+ * decodes that column's block of each chunk, one chunk at a time, so the pages holding
+ * the other columns are never touched and memory use doesn't grow with the file.
+ */
+
+#ifndef STATSREADER_H
+#define STATSREADER_H
+
+// System/standard libraries
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "GameRecord.h"
+
+class StatsReader {
+public:
+    // Called with each chunk's values of the scanned column
+    using Visitor = std::function<void(const std::uint64_t *values, size_t count)>;
+
+    // Constructor and destructor
+    StatsReader();
+    virtual ~StatsReader();
+
+    // Opening and closing
+    bool open(const std::string &path);
+    void close();
+
+    // File contents
+    size_t getChunkCount() const;
+    std::uint64_t getRowCount() const;
+    bool getChunkRange(size_t chunk, int column, std::uint64_t &min, std::uint64_t &max) const;
+    bool readColumn(size_t chunk, int column, std::vector<std::uint64_t> &values) const;
+
+    // Visits every chunk whose min/max overlaps [min, max]; returns the number of rows visited
+    std::uint64_t scanColumn(int column, const Visitor &visit, std::uint64_t min = 0,
+                             std::uint64_t max = UINT64_MAX) const;
+
+private:
+    // Where one column of one chunk lives in the mapping
+    struct Block {
+        const std::uint8_t *data;
+        std::uint32_t size;
+        std::uint8_t codec;
+        std::uint8_t width;
+        std::uint64_t min;
+        std::uint64_t max;
+    };
+    struct Chunk {
+        std::uint32_t rows;
+        Block blocks[GameRecord::COLUMN_COUNT];
+    };
+
+    // Instance variables
+    const std::uint8_t *data;
+    size_t size;
+    std::vector<Chunk> chunks;
+    std::uint64_t rows;
+
+    // Private functions
+    static bool decode(const Block &block, std::uint32_t rows, std::uint64_t *out);
+};
+
+#endif // STATSREADER_H
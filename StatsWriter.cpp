@@ -0,0 +1,376 @@
+/*
+ * Author: Martin Nguyen
+ * Description: Implementation of the StatsWriter class for Minesweeper game
+ * Date: 10/19/2026
+ */
+
+#include "StatsWriter.h"
+
+// System/standard libraries
+#include <algorithm>
+#include <filesystem>
+
+namespace {
+
+// Little-endian helpers for the file format
+void storeU32(std::uint8_t *p, std::uint32_t value)
+{
+    for (int i = 0; i < 4; ++i)
+        p[i] = static_cast<std::uint8_t>(value >> (8 * i));
+}
+
+void storeU64(std::uint8_t *p, std::uint64_t value)
+{
+    for (int i = 0; i < 8; ++i)
+        p[i] = static_cast<std::uint8_t>(value >> (8 * i));
+}
+
+std::uint32_t readU32(const std::uint8_t *p)
+{
+    return static_cast<std::uint32_t>(p[0]) | (static_cast<std::uint32_t>(p[1]) << 8) |
+           (static_cast<std::uint32_t>(p[2]) << 16) | (static_cast<std::uint32_t>(p[3]) << 24);
+}
+
+size_t padded(size_t size)
+{
+    return (size + StatsWriter::BLOCK_ALIGN - 1) / StatsWriter::BLOCK_ALIGN * StatsWriter::BLOCK_ALIGN;
+}
+
+} // namespace
+
+/*
+ * Constructor: StatsWriter
+ * Description: Creates a writer with no file open
+ */
+StatsWriter::StatsWriter()
+    : compress(true), chunkRows(DEFAULT_CHUNK_ROWS), queueCapacity(DEFAULT_QUEUE_CAPACITY), closing(false),
+      rowsWritten(0), dropped(0), failed(false)
+{
+}
+
+/*
+ * Destructor: StatsWriter
+ * Description: Writes anything still queued and closes the file
+ */
+StatsWriter::~StatsWriter()
+{
+    close();
+}
+
+/*
+ * Function: open
+ * Description: Opens a statistics file for appending (creating it if needed) and starts the writer thread
+ * Parameters: path - The file, compress - Allow the delta codec, chunkRows - Rows per chunk,
+ *             queueCapacity - Records that can wait for the writer before push has to wait
+ * Returns: true on success, false if the file can't be written or isn't a statistics file
+ */
+bool StatsWriter::open(const std::string &path, bool compress, size_t chunkRows, size_t queueCapacity)
+{
+    close();
+    if (!openForAppend(path))
+        return false;
+
+    this->compress = compress;
+    this->chunkRows = std::max<size_t>(chunkRows, 1);
+    this->queueCapacity = std::max<size_t>(queueCapacity, 1);
+    closing = false;
+    failed = false;
+    queue.reserve(this->queueCapacity);
+    for (std::vector<std::uint64_t> &values : columns)
+    {
+        values.clear();
+        values.reserve(this->chunkRows);
+    }
+    writer = std::thread(&StatsWriter::run, this);
+    return true;
+}
+
+/*
+ * Function: close
+ * Description: Writes every queued record, stops the writer thread and closes the file
+ */
+void StatsWriter::close()
+{
+    if (!writer.joinable())
+        return;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        closing = true;
+    }
+    queueReady.notify_one();
+    queueSpace.notify_all();
+    writer.join();
+    file.close();
+}
+
+/*
+ * Function: isOpen
+ * Description: Checks if a file is open
+ * Returns: true if records can be pushed
+ */
+bool StatsWriter::isOpen() const
+{
+    return writer.joinable();
+}
+
+/*
+ * Function: push
+ * Description: Queues a record for the writer thread, waiting while the queue is full.
+ *              Never waits on the file itself.
+ * Parameters: record - The record
+ * Returns: true if queued, false if the writer is closed
+ */
+bool StatsWriter::push(const GameRecord &record)
+{
+    std::unique_lock<std::mutex> lock(mutex);
+    queueSpace.wait(lock, [this] { return queue.size() < queueCapacity || closing; });
+    if (closing || !writer.joinable())
+        return false;
+    bool wasEmpty = queue.empty();
+    queue.push_back(record);
+    lock.unlock();
+    if (wasEmpty)
+        queueReady.notify_one();
+    return true;
+}
+
+/*
+ * Function: tryPush
+ * Description: Queues a record for the writer thread without ever waiting; a full queue drops it
+ * Parameters: record - The record
+ * Returns: true if queued, false if dropped or the writer is closed
+ */
+bool StatsWriter::tryPush(const GameRecord &record)
+{
+    std::unique_lock<std::mutex> lock(mutex);
+    if (closing || !writer.joinable() || queue.size() >= queueCapacity)
+    {
+        ++dropped;
+        return false;
+    }
+    bool wasEmpty = queue.empty();
+    queue.push_back(record);
+    lock.unlock();
+    if (wasEmpty)
+        queueReady.notify_one();
+    return true;
+}
+
+/*
+ * Function: getRowsWritten
+ * Description: Gets the number of records written to the file so far
+ * Returns: Row count
+ */
+std::uint64_t StatsWriter::getRowsWritten() const
+{
+    return rowsWritten;
+}
+
+/*
+ * Function: getDropped
+ * Description: Gets the number of records tryPush dropped because the queue was full
+ * Returns: Dropped record count
+ */
+std::uint64_t StatsWriter::getDropped() const
+{
+    return dropped;
+}
+
+/*
+ * Function: hasFailed
+ * Description: Checks if a chunk could not be written (records after that are discarded)
+ * Returns: true after a write error
+ */
+bool StatsWriter::hasFailed() const
+{
+    return failed;
+}
+
+/*
+ * Function: run
+ * Description: Writer thread: takes everything queued at once, adds it to the current chunk
+ *              and writes each chunk as it fills up. The last partial chunk is written on close.
+ */
+void StatsWriter::run()
+{
+    std::vector<GameRecord> batch;
+    batch.reserve(queueCapacity);
+    for (;;)
+    {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            queueReady.wait(lock, [this] { return !queue.empty() || closing; });
+            if (queue.empty())
+                break; // closing, and nothing left to write
+            batch.swap(queue);
+        }
+        queueSpace.notify_all();
+
+        for (const GameRecord &record : batch)
+        {
+            for (int column = 0; column < GameRecord::COLUMN_COUNT; ++column)
+                columns[column].push_back(record.get(column));
+            if (columns[0].size() >= chunkRows)
+                writeChunk();
+        }
+        batch.clear();
+    }
+    if (!columns[0].empty())
+        writeChunk();
+}
+
+/*
+ * Function: writeChunk
+ * Description: Encodes the rows collected so far as one chunk and appends it to the file
+ * Returns: true if the chunk was written
+ */
+bool StatsWriter::writeChunk()
+{
+    size_t rows = columns[0].size();
+    size_t directorySize = CHUNK_HEADER_SIZE + GameRecord::COLUMN_COUNT * COLUMN_ENTRY_SIZE;
+    chunk.assign(directorySize, 0);
+    storeU32(&chunk[0], CHUNK_MAGIC);
+    storeU32(&chunk[4], static_cast<std::uint32_t>(rows));
+
+    for (int column = 0; column < GameRecord::COLUMN_COUNT; ++column)
+    {
+        const std::vector<std::uint64_t> &values = columns[column];
+        std::uint64_t low = *std::min_element(values.begin(), values.end());
+        std::uint64_t high = *std::max_element(values.begin(), values.end());
+        size_t start = chunk.size();
+        std::uint8_t codec = CODEC_RAW;
+        encodeColumn(column, chunk, codec);
+        size_t size = chunk.size() - start;
+        chunk.resize(start + padded(size), 0);
+
+        std::uint8_t *entry = &chunk[CHUNK_HEADER_SIZE + column * COLUMN_ENTRY_SIZE];
+        entry[0] = codec;
+        entry[1] = static_cast<std::uint8_t>(GameRecord::getColumnWidth(column));
+        storeU32(entry + 4, static_cast<std::uint32_t>(size));
+        storeU64(entry + 8, low);
+        storeU64(entry + 16, high);
+    }
+
+    for (std::vector<std::uint64_t> &values : columns)
+        values.clear();
+    if (failed)
+        return false;
+
+    // Flushed per chunk, so a crash can only tear the chunk being written
+    file.write(reinterpret_cast<const char *>(chunk.data()), static_cast<std::streamsize>(chunk.size()));
+    file.flush();
+    if (!file)
+    {
+        failed = true;
+        return false;
+    }
+    rowsWritten += rows;
+    return true;
+}
+
+/*
+ * Function: encodeColumn
+ * Description: Appends one column of the current chunk, delta coded if allowed and smaller than raw
+ * Parameters: column - The column, out - Buffer to append to, codec - Set to the codec used
+ */
+void StatsWriter::encodeColumn(int column, std::vector<std::uint8_t> &out, std::uint8_t &codec) const
+{
+    const std::vector<std::uint64_t> &values = columns[column];
+    const int width = GameRecord::getColumnWidth(column);
+    const size_t rawSize = values.size() * static_cast<size_t>(width);
+    const size_t start = out.size();
+
+    if (compress)
+    {
+        // Zigzag keeps small negative steps small; varint stores 7 bits per byte
+        std::uint64_t previous = 0;
+        for (std::uint64_t value : values)
+        {
+            std::uint64_t delta = value - previous;
+            std::uint64_t zigzag = (delta << 1) ^ (0 - (delta >> 63));
+            previous = value;
+            while (zigzag >= 0x80)
+            {
+                out.push_back(static_cast<std::uint8_t>(zigzag | 0x80));
+                zigzag >>= 7;
+            }
+            out.push_back(static_cast<std::uint8_t>(zigzag));
+            if (out.size() - start >= rawSize)
+                break; // already no smaller than raw
+        }
+        if (out.size() - start < rawSize)
+        {
+            codec = CODEC_DELTA;
+            return;
+        }
+        out.resize(start);
+    }
+
+    codec = CODEC_RAW;
+    out.resize(start + rawSize);
+    std::uint8_t *p = &out[start];
+    for (std::uint64_t value : values)
+    {
+        for (int i = 0; i < width; ++i)
+            *p++ = static_cast<std::uint8_t>(value >> (8 * i));
+    }
+}
+
+/*
+ * Function: openForAppend
+ * Description: Opens the file for appending. A new file gets a header; an existing one is checked,
+ *              and anything after its last complete chunk (a write cut short by a crash) is cut off.
+ * Parameters: path - The file
+ * Returns: true if the file is ready to append chunks to
+ */
+bool StatsWriter::openForAppend(const std::string &path)
+{
+    std::error_code error;
+    std::uintmax_t size = std::filesystem::file_size(path, error);
+    if (error || size == 0)
+    {
+        std::uint8_t header[FILE_HEADER_SIZE] = {};
+        storeU32(header, FILE_MAGIC);
+        storeU32(header + 4, VERSION);
+        storeU32(header + 8, GameRecord::COLUMN_COUNT);
+        file.open(path, std::ios::binary | std::ios::trunc);
+        file.write(reinterpret_cast<const char *>(header), sizeof(header));
+        file.flush();
+        if (!file)
+            file.close();
+        return file.is_open();
+    }
+
+    std::ifstream in(path, std::ios::binary);
+    std::uint8_t header[FILE_HEADER_SIZE];
+    if (!in.read(reinterpret_cast<char *>(header), sizeof(header)) || readU32(header) != FILE_MAGIC ||
+        readU32(header + 4) != VERSION || readU32(header + 8) != GameRecord::COLUMN_COUNT)
+        return false; // not one of ours: leave it alone
+
+    // Walk the chunk headers to find where the last complete chunk ends
+    std::uintmax_t end = FILE_HEADER_SIZE;
+    std::vector<std::uint8_t> directory(CHUNK_HEADER_SIZE + GameRecord::COLUMN_COUNT * COLUMN_ENTRY_SIZE);
+    while (end + directory.size() <= size)
+    {
+        in.seekg(static_cast<std::streamoff>(end));
+        if (!in.read(reinterpret_cast<char *>(directory.data()), static_cast<std::streamsize>(directory.size())) ||
+            readU32(&directory[0]) != CHUNK_MAGIC)
+            break;
+        std::uintmax_t length = directory.size();
+        for (int column = 0; column < GameRecord::COLUMN_COUNT; ++column)
+            length += padded(readU32(&directory[CHUNK_HEADER_SIZE + column * COLUMN_ENTRY_SIZE + 4]));
+        if (end + length > size)
+            break;
+        end += length;
+    }
+    in.close();
+
+    if (end < size)
+    {
+        std::filesystem::resize_file(path, end, error);
+        if (error)
+            return false;
+    }
+    file.open(path, std::ios::binary | std::ios::app);
+    return file.is_open();
+}
@@ -0,0 +1,102 @@
+/*
+ * Author: Martin Nguyen
+ * Description: StatsWriter class, appends game records to a columnar statistics file
+ * Date: 10/19/2026
+ *
+ * File layout (all integers little-endian):
+ *
+ *   file header:  u32 FILE_MAGIC, u32 VERSION, u32 column count, u32 reserved
+ *   chunk:        u32 CHUNK_MAGIC, u32 rows,
+ *                 column count x (u8 codec, u8 width, u16 reserved, u32 block size, u64 min, u64 max),
+ *                 column count x block, each padded to 8 bytes
+ *
+ * A CODEC_RAW block is rows x width bytes. A CODEC_DELTA block holds the differences
+ * between neighbouring rows, zigzag and varint coded; it's only used when it comes out
+ * smaller. The min/max pair lets a reader skip chunks without touching their blocks.
+ *
+ * Game threads only copy a record into a bounded queue; one writer thread builds the
+ * chunks and does all of the file I/O. A chunk is written once it has chunkRows rows
+ * (and on close), so a crash loses at most the rows not yet written; writers that must
+ * not lose a game (like the GUI's) use a chunkRows of 1. A torn chunk at the end of
+ * the file is cut off the next time the file is opened.
+ */
+
+#ifndef STATSWRITER_H
+#define STATSWRITER_H
+
+// System/standard libraries
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "GameRecord.h"
+
+class StatsWriter {
+public:
+    // File format
+    static constexpr std::uint32_t FILE_MAGIC = 0x5453534D;  // "MSST"
+    static constexpr std::uint32_t CHUNK_MAGIC = 0x4B4E4843; // "CHNK"
+    static constexpr std::uint32_t VERSION = 1;
+    static constexpr int FILE_HEADER_SIZE = 16;
+    static constexpr int CHUNK_HEADER_SIZE = 8;
+    static constexpr int COLUMN_ENTRY_SIZE = 24;
+    static constexpr int BLOCK_ALIGN = 8;
+
+    // Column block codecs
+    static constexpr std::uint8_t CODEC_RAW = 0;
+    static constexpr std::uint8_t CODEC_DELTA = 1;
+
+    // Defaults: 64K rows per chunk, room for 4K records waiting to be written
+    static constexpr size_t DEFAULT_CHUNK_ROWS = 65536;
+    static constexpr size_t DEFAULT_QUEUE_CAPACITY = 4096;
+
+    // Constructor and destructor
+    StatsWriter();
+    virtual ~StatsWriter();
+
+    // Opening and closing (close writes whatever is still queued)
+    bool open(const std::string &path, bool compress = true, size_t chunkRows = DEFAULT_CHUNK_ROWS,
+              size_t queueCapacity = DEFAULT_QUEUE_CAPACITY);
+    void close();
+    bool isOpen() const;
+
+    // Adding records: push waits while the queue is full, tryPush drops the record instead
+    bool push(const GameRecord &record);
+    bool tryPush(const GameRecord &record);
+
+    // Counters
+    std::uint64_t getRowsWritten() const;
+    std::uint64_t getDropped() const;
+    bool hasFailed() const;
+
+private:
+    // Instance variables
+    std::ofstream file;
+    bool compress;
+    size_t chunkRows;
+    size_t queueCapacity;
+    std::thread writer;
+    std::mutex mutex;
+    std::condition_variable queueReady; // records waiting, or closing
+    std::condition_variable queueSpace; // room in the queue, or closing
+    std::vector<GameRecord> queue;
+    bool closing;
+    std::vector<std::uint64_t> columns[GameRecord::COLUMN_COUNT]; // rows of the chunk being built (writer thread only)
+    std::vector<std::uint8_t> chunk;
+    std::atomic<std::uint64_t> rowsWritten;
+    std::atomic<std::uint64_t> dropped;
+    std::atomic<bool> failed;
+
+    // Private functions
+    void run();
+    bool writeChunk();
+    void encodeColumn(int column, std::vector<std::uint8_t> &out, std::uint8_t &codec) const;
+    bool openForAppend(const std::string &path);
+};
+
+#endif // STATSWRITER_H
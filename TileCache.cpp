@@ -0,0 +1,109 @@
+/*
+ * Author: Martin Nguyen
+ * Description: Implementation of TileCache class for Minesweeper game
+ * Date: 10/19/2026
+ */
+
+#include "TileCache.h"
+
+// Qt libraries
+#include <QColor>
+#include <QFont>
+#include <QGuiApplication>
+#include <QPainter>
+#include <QPixmap>
+
+/*
+ * Function: warmUp
+ * Description: Renders every tile now, so the first reveal doesn't pay for it
+ */
+void TileCache::warmUp()
+{
+    mine();
+    flag();
+    question();
+    number(1);
+}
+
+/*
+ * Function: mine
+ * Description: Gets the mine tile (rendered on first use)
+ * Returns: The mine icon
+ */
+const QIcon &TileCache::mine()
+{
+    static const QIcon icon = render("💣", Qt::black, false);
+    return icon;
+}
+
+/*
+ * Function: flag
+ * Description: Gets the flag tile (rendered on first use)
+ * Returns: The flag icon
+ */
+const QIcon &TileCache::flag()
+{
+    static const QIcon icon = render("🚩", Qt::black, false);
+    return icon;
+}
+
+/*
+ * Function: question
+ * Description: Gets the question mark tile (rendered on first use)
+ * Returns: The question mark icon
+ */
+const QIcon &TileCache::question()
+{
+    static const QIcon icon = render("❓", Qt::black, false);
+    return icon;
+}
+
+/*
+ * Function: number
+ * Description: Gets the tile for a revealed number, each in its own danger colour
+ * Parameters: adjacentMines - The number to show (1 to 8)
+ * Returns: The number icon
+ */
+const QIcon &TileCache::number(int adjacentMines)
+{
+    static const QIcon icons[8] = {
+        render("1", QColor("blue"), true),
+        render("2", QColor("green"), true),
+        render("3", QColor("red"), true),
+        render("4", QColor("darkblue"), true),
+        render("5", QColor("darkred"), true),
+        render("6", QColor("teal"), true),
+        render("7", QColor("black"), true),
+        render("8", QColor("gray"), true),
+    };
+    return icons[adjacentMines - 1];
+}
+
+/*
+ * Function: render
+ * Description: Rasterises a glyph once into a pixmap at the screen's pixel ratio
+ * Parameters: text - The glyph, color - Text colour, bold - Whether to use a bold font
+ * Returns: An icon that looks the same on enabled and disabled buttons
+ */
+QIcon TileCache::render(const QString &text, const QColor &color, bool bold)
+{
+    qreal ratio = qGuiApp ? qGuiApp->devicePixelRatio() : 1.0;
+    QPixmap pixmap(qRound(TILE_SIZE * ratio), qRound(TILE_SIZE * ratio));
+    pixmap.setDevicePixelRatio(ratio);
+    pixmap.fill(Qt::transparent);
+
+    QPainter painter(&pixmap);
+    QFont font = painter.font();
+    font.setBold(bold);
+    font.setPixelSize(TILE_SIZE - 6);
+    painter.setFont(font);
+    painter.setPen(color);
+    painter.drawText(QRect(0, 0, TILE_SIZE, TILE_SIZE), Qt::AlignCenter, text);
+    painter.end();
+
+    // Revealed squares are disabled buttons; keep their numbers from being greyed out
+    QIcon icon;
+    icon.addPixmap(pixmap, QIcon::Normal);
+    icon.addPixmap(pixmap, QIcon::Disabled);
+    return icon;
+}
@@ -0,0 +1,30 @@
+/*
+ * Author: Martin Nguyen
+ * Description: TileCache class, pre-rendered icons for the Minesweeper buttons
+ * Date: 10/19/2026
+ */
+
+#ifndef TILECACHE_H
+#define TILECACHE_H
+
+// Qt libraries
+#include <QIcon>
+
+class TileCache {
+public:
+    // Size of the rendered tiles in device independent pixels
+    static constexpr int TILE_SIZE = 22;
+
+    // Public functions
+    static void warmUp();
+    static const QIcon& mine();
+    static const QIcon& flag();
+    static const QIcon& question();
+    static const QIcon& number(int adjacentMines);
+
+private:
+    // Private functions
+    static QIcon render(const QString& text, const QColor& color, bool bold);
+};
+
+#endif // TILECACHE_H
@@ -0,0 +1,10 @@
+# Board corpora: compact layout records in memory-mapped segments (needs engine.pri; the reader is POSIX: uses mmap).
+SOURCES += \
+    $$PWD/CorpusReader.cpp \
+    $$PWD/CorpusWriter.cpp \
+    $$PWD/LayoutCodec.cpp
+
+HEADERS += \
+    $$PWD/CorpusReader.h \
+    $$PWD/CorpusWriter.h \
+    $$PWD/LayoutCodec.h
@@ -0,0 +1,12 @@
+# Headless game engine, shared by the Qt front end and the command-line tools.
+INCLUDEPATH += $$PWD
+
+SOURCES += \
+    $$PWD/GameEngine.cpp \
+    $$PWD/PersistentBoard.cpp \
+    $$PWD/Space.cpp
+
+HEADERS += \
+    $$PWD/GameEngine.h \
+    $$PWD/PersistentBoard.h \
+    $$PWD/Space.h
@@ -7,6 +7,9 @@
 #ifndef MAINWINDOW_H
 #define MAINWINDOW_H
 
+// System/standard libraries
+#include <chrono>
+
 // Qt libraries
 #include <QMainWindow>
 
@@ -29,9 +32,19 @@ public:
     MainWindow(QWidget *parent = nullptr);
     ~MainWindow();
 
+    // Public functions
+    void reportStartupTime(std::chrono::steady_clock::time_point start, int budgetMs = -1);
+
+protected:
+    void paintEvent(QPaintEvent *event) override;
+
 private:
     // Instance variables
     Ui::MainWindow *ui;
     Gameboard* gameBoard;
+    bool firstFramePainted;
+    bool startupPending;
+    std::chrono::steady_clock::time_point startupStart;
+    int startupBudgetMs;
 };
 #endif // MAINWINDOW_H
@@ -8,15 +8,19 @@ CONFIG += c++17
 # In order to do so, uncomment the following line.
 #DEFINES += QT_DISABLE_DEPRECATED_BEFORE=0x060000    # disables all the APIs deprecated before Qt 6.0.0
 
+include(engine.pri)
+include(solver.pri)
+include(stats.pri)
+
 SOURCES += \
     Gameboard.cpp \
-    Space.cpp \
+    TileCache.cpp \
     main.cpp \
     mainwindow.cpp
 
 HEADERS += \
     Gameboard.h \
-    Space.h \
+    TileCache.h \
     mainwindow.h
 
 FORMS += \
@@ -0,0 +1,8 @@
+# Solver and its precomputed pattern table (needs engine.pri).
+SOURCES += \
+    $$PWD/PatternDatabase.cpp \
+    $$PWD/Solver.cpp
+
+HEADERS += \
+    $$PWD/PatternDatabase.h \
+    $$PWD/Solver.h
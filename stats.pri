@@ -0,0 +1,10 @@
+# Per-game statistics records and the background writer for statistics files (needs engine.pri).
+CONFIG += thread
+
+SOURCES += \
+    $$PWD/GameRecord.cpp \
+    $$PWD/StatsWriter.cpp
+
+HEADERS += \
+    $$PWD/GameRecord.h \
+    $$PWD/StatsWriter.h
@@ -0,0 +1,17 @@
+# Benchmark: GameBatch (structure-of-arrays) against independent GameEngines.
+TEMPLATE = app
+TARGET = batchbench
+CONFIG += console c++17 release
+CONFIG -= app_bundle qt
+
+# Let the compiler vectorise the per-game inner loops
+gcc|clang: QMAKE_CXXFLAGS_RELEASE += -O3
+
+include(../../engine.pri)
+
+SOURCES += \
+    ../../GameBatch.cpp \
+    main.cpp
+
+HEADERS += \
+    ../../GameBatch.h
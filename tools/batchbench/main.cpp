@@ -0,0 +1,84 @@
+/*
+ * Author: Martin Nguyen
+ * Description: Benchmark comparing GameBatch against K independent GameEngine objects
+ * Date: 10/19/2026
+ */
+
+#include "GameBatch.h"
+#include "GameEngine.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+/*
+ * Function: main
+ * Description: Plays the same opening click on K seeded games both ways, checks the results
+ *              match and prints the time per game. Usage: batchbench [games] [trials]
+ */
+int main(int argc, char *argv[])
+{
+    using Clock = std::chrono::steady_clock;
+    const int games = argc > 1 ? std::atoi(argv[1]) : 4096;
+    const int trials = argc > 2 ? std::atoi(argv[2]) : 20;
+    const int width = GameEngine::DEFAULT_WIDTH;
+    const int height = GameEngine::DEFAULT_HEIGHT;
+    const int mines = GameEngine::DEFAULT_MINES;
+    const int row = height / 2;
+    const int col = width / 2;
+
+    GameBatch batch(games, width, height, mines);
+    std::vector<GameEngine> engines(games, GameEngine(width, height, mines));
+    std::vector<std::uint32_t> seeds(games);
+    std::vector<int> engineRevealed(games);
+    double batchSeconds = 0;
+    double engineSeconds = 0;
+    int mismatches = 0;
+    int wins = 0;
+
+    for (int trial = 0; trial < trials; ++trial)
+    {
+        for (int g = 0; g < games; ++g)
+            seeds[g] = static_cast<std::uint32_t>(trial * games + g + 1);
+
+        Clock::time_point start = Clock::now();
+        batch.reset(seeds);
+        batch.revealAll(row, col);
+        batch.checkWins();
+        batchSeconds += std::chrono::duration<double>(Clock::now() - start).count();
+
+        start = Clock::now();
+        for (int g = 0; g < games; ++g)
+        {
+            engines[g].reset();
+            engines[g].setSeed(seeds[g]);
+            engineRevealed[g] = engines[g].reveal(row, col);
+        }
+        engineSeconds += std::chrono::duration<double>(Clock::now() - start).count();
+
+        // Both paths play the same games, so they must agree
+        for (int g = 0; g < games; ++g)
+        {
+            GameEngine::Status status = engines[g].getStatus();
+            if (status != batch.getStatus(g) ||
+                (status != GameEngine::Status::Lost && engineRevealed[g] != batch.getRevealedCount(g)))
+                ++mismatches;
+            if (status == GameEngine::Status::Won)
+                ++wins;
+        }
+    }
+
+    double perGame = 1e6 / (static_cast<double>(games) * trials);
+    std::cout << games << " games x " << trials << " trials on " << width << "x" << height
+              << " with " << mines << " mines (" << wins << " won on the first click)" << std::endl;
+    std::cout << "GameBatch:   " << batchSeconds * perGame << " us/game" << std::endl;
+    std::cout << "GameEngine:  " << engineSeconds * perGame << " us/game" << std::endl;
+    std::cout << "speedup:     " << engineSeconds / batchSeconds << "x" << std::endl;
+    if (mismatches != 0)
+    {
+        std::cerr << mismatches << " games disagree between GameBatch and GameEngine" << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,11 @@
+# Bot client for the game server: measures request latency and checks
+# the history opcodes can't be used to cheat (Linux/POSIX sockets).
+TEMPLATE = app
+TARGET = botclient
+CONFIG += console c++17 release
+CONFIG -= app_bundle qt
+
+INCLUDEPATH += ../..
+
+SOURCES += \
+    main.cpp
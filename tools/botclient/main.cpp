@@ -0,0 +1,329 @@
+/*
+ * Author: Martin Nguyen
+ * Description: Bot client for the headless game server: measures request round-trip latency and
+ *              checks that the history opcodes can't be used to cheat
+ * Date: 10/19/2026
+ */
+
+#include "GameServer.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace {
+
+// One decoded server response
+struct Response {
+    std::uint8_t opcode;
+    std::uint8_t status;
+    std::vector<std::uint8_t> cells; // count x (u32 cell index, u8 cell code)
+};
+
+void appendU16(std::vector<std::uint8_t> &out, std::uint32_t value)
+{
+    out.push_back(static_cast<std::uint8_t>(value));
+    out.push_back(static_cast<std::uint8_t>(value >> 8));
+}
+
+void appendU32(std::vector<std::uint8_t> &out, std::uint32_t value)
+{
+    for (int i = 0; i < 4; ++i)
+        out.push_back(static_cast<std::uint8_t>(value >> (8 * i)));
+}
+
+std::uint32_t readU32(const std::uint8_t *p)
+{
+    return static_cast<std::uint32_t>(p[0]) | (static_cast<std::uint32_t>(p[1]) << 8) |
+           (static_cast<std::uint32_t>(p[2]) << 16) | (static_cast<std::uint32_t>(p[3]) << 24);
+}
+
+/*
+ * Function: connectUnix
+ * Description: Connects to the server's Unix socket
+ * Parameters: path - Socket path
+ * Returns: The socket, or -1 on failure
+ */
+int connectUnix(const std::string &path)
+{
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    sockaddr_un addr {};
+    addr.sun_family = AF_UNIX;
+    if (fd < 0 || path.size() >= sizeof(addr.sun_path))
+        return -1;
+    std::memcpy(addr.sun_path, path.c_str(), path.size() + 1);
+    if (connect(fd, reinterpret_cast<sockaddr *>(&addr), sizeof(addr)) != 0)
+    {
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+/*
+ * Function: connectTcp
+ * Description: Connects to the server on a local TCP port, with Nagle's algorithm off
+ * Parameters: port - The port
+ * Returns: The socket, or -1 on failure
+ */
+int connectTcp(std::uint16_t port)
+{
+    int fd = socket(AF_INET, SOCK_STREAM, 0);
+    if (fd < 0)
+        return -1;
+    sockaddr_in addr {};
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(port);
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    int on = 1;
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &on, sizeof(on));
+    if (connect(fd, reinterpret_cast<sockaddr *>(&addr), sizeof(addr)) != 0)
+    {
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+/*
+ * Function: readExactly
+ * Description: Reads a fixed number of bytes from the socket
+ * Parameters: fd - The socket, data - Where to put them, size - How many
+ * Returns: false if the connection closed or failed first
+ */
+bool readExactly(int fd, std::uint8_t *data, size_t size)
+{
+    while (size > 0)
+    {
+        ssize_t n = recv(fd, data, size, 0);
+        if (n <= 0)
+            return false;
+        data += n;
+        size -= static_cast<size_t>(n);
+    }
+    return true;
+}
+
+/*
+ * Function: request
+ * Description: Sends one request frame and waits for its response
+ * Parameters: fd - The socket, payload - Request payload, response - Set to the response
+ * Returns: false if the connection failed or the response is malformed
+ */
+bool request(int fd, const std::vector<std::uint8_t> &payload, Response &response)
+{
+    std::vector<std::uint8_t> frame;
+    appendU32(frame, static_cast<std::uint32_t>(payload.size()));
+    frame.insert(frame.end(), payload.begin(), payload.end());
+    if (send(fd, frame.data(), frame.size(), MSG_NOSIGNAL) != static_cast<ssize_t>(frame.size()))
+        return false;
+
+    std::uint8_t header[10];
+    if (!readExactly(fd, header, sizeof(header)))
+        return false;
+    std::uint32_t length = readU32(header);
+    std::uint32_t count = readU32(header + 6);
+    if (length < 6 || length - 6 != static_cast<std::uint64_t>(count) * 5)
+        return false;
+    response.opcode = header[4];
+    response.status = header[5];
+    response.cells.resize(length - 6);
+    return readExactly(fd, response.cells.data(), response.cells.size());
+}
+
+/*
+ * Function: newGame
+ * Description: Builds an OP_NEW request
+ * Parameters: width/height/mines - Board size, seed - Mine seed (0 = random)
+ * Returns: The request payload
+ */
+std::vector<std::uint8_t> newGame(int width, int height, std::uint32_t mines, std::uint32_t seed)
+{
+    std::vector<std::uint8_t> payload { GameServer::OP_NEW };
+    appendU16(payload, static_cast<std::uint32_t>(width));
+    appendU16(payload, static_cast<std::uint32_t>(height));
+    appendU32(payload, mines);
+    appendU32(payload, seed);
+    return payload;
+}
+
+/*
+ * Function: move
+ * Description: Builds a request for a move on one square
+ * Parameters: opcode - OP_REVEAL, OP_FLAG or OP_CHORD, row/col - The square
+ * Returns: The request payload
+ */
+std::vector<std::uint8_t> move(std::uint8_t opcode, int row, int col)
+{
+    std::vector<std::uint8_t> payload { opcode };
+    appendU16(payload, static_cast<std::uint32_t>(row));
+    appendU16(payload, static_cast<std::uint32_t>(col));
+    return payload;
+}
+
+/*
+ * Function: latency
+ * Description: Times request round trips one at a time (flag toggles on a 30x16 board, so every
+ *              response is one cell) and prints the mean and percentiles
+ * Parameters: fd - The socket, requests - Round trips to time
+ * Returns: Process exit status
+ */
+int latency(int fd, int requests)
+{
+    using Clock = std::chrono::steady_clock;
+    Response response;
+    if (!request(fd, newGame(30, 16, 99, 1), response) || !request(fd, move(GameServer::OP_REVEAL, 8, 15), response))
+    {
+        std::cerr << "The server did not answer" << std::endl;
+        return 1;
+    }
+
+    // Warm up the connection and both caches before timing
+    const std::vector<std::uint8_t> flag = move(GameServer::OP_FLAG, 0, 0);
+    for (int i = 0; i < 1000; ++i)
+        request(fd, flag, response);
+
+    std::vector<double> micros(static_cast<size_t>(requests));
+    for (int i = 0; i < requests; ++i)
+    {
+        Clock::time_point start = Clock::now();
+        if (!request(fd, flag, response))
+        {
+            std::cerr << "Connection lost" << std::endl;
+            return 1;
+        }
+        micros[static_cast<size_t>(i)] = std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+    }
+
+    double total = 0;
+    for (double value : micros)
+        total += value;
+    std::sort(micros.begin(), micros.end());
+    auto percentile = [&](double p) { return micros[static_cast<size_t>(p * (micros.size() - 1))]; };
+    std::cout << requests << " round trips: mean " << total / requests << " us, p50 " << percentile(0.5)
+              << " us, p99 " << percentile(0.99) << " us, max " << micros.back() << " us" << std::endl;
+    return 0;
+}
+
+/*
+ * Function: check
+ * Description: Checks the server keeps the history opcodes from leaking mines. Without analysis
+ *              mode all five must be refused; with it, a game lost inside a what-if branch must
+ *              not be rolled back or undone.
+ * Parameters: fd - The socket
+ * Returns: Process exit status (1 if the server can be cheated)
+ */
+int check(int fd)
+{
+    Response response;
+    if (!request(fd, newGame(30, 16, 99, 1), response))
+    {
+        std::cerr << "The server did not answer" << std::endl;
+        return 1;
+    }
+
+    const std::uint8_t history[] = { GameServer::OP_WHATIF, GameServer::OP_UNDO, GameServer::OP_REDO,
+                                     GameServer::OP_ROLLBACK, GameServer::OP_COMMIT };
+    if (!request(fd, { GameServer::OP_WHATIF }, response))
+        return 1;
+    if (response.status == GameServer::STATUS_ERROR)
+    {
+        for (std::uint8_t opcode : history)
+        {
+            if (!request(fd, { opcode }, response) || response.status != GameServer::STATUS_ERROR)
+            {
+                std::cerr << "FAIL: opcode " << int(opcode) << " accepted without analysis mode" << std::endl;
+                return 1;
+            }
+        }
+        std::cout << "ok: history opcodes are refused (analysis mode off)" << std::endl;
+        return 0;
+    }
+
+    // Analysis mode: lose inside the what-if branch, then try to take it back
+    for (int index = 0; index < 30 * 16 && response.status != GameServer::STATUS_LOST; ++index)
+    {
+        if (!request(fd, move(GameServer::OP_REVEAL, index / 30, index % 30), response))
+            return 1;
+    }
+    if (response.status != GameServer::STATUS_LOST)
+    {
+        std::cerr << "FAIL: could not lose the game" << std::endl;
+        return 1;
+    }
+    for (std::uint8_t opcode : { GameServer::OP_ROLLBACK, GameServer::OP_UNDO })
+    {
+        if (!request(fd, { opcode }, response) || response.status != GameServer::STATUS_ERROR)
+        {
+            std::cerr << "FAIL: opcode " << int(opcode) << " took back a lost game" << std::endl;
+            return 1;
+        }
+    }
+    std::cout << "ok: a lost game can't be rolled back or undone (analysis mode on)" << std::endl;
+    return 0;
+}
+
+} // namespace
+
+/*
+ * Function: main
+ * Description: Usage: botclient [--unix PATH | --tcp PORT] latency [requests]
+ *                     botclient [--unix PATH | --tcp PORT] check
+ *              (defaults to the server's Unix socket at /tmp/minesweeper.sock)
+ */
+int main(int argc, char *argv[])
+{
+    std::string path = "/tmp/minesweeper.sock";
+    int port = 0;
+    int arg = 1;
+    if (arg + 1 < argc && std::strcmp(argv[arg], "--unix") == 0)
+    {
+        path = argv[arg + 1];
+        arg += 2;
+    }
+    else if (arg + 1 < argc && std::strcmp(argv[arg], "--tcp") == 0)
+    {
+        port = std::atoi(argv[arg + 1]);
+        arg += 2;
+    }
+
+    bool isLatency = arg < argc && std::strcmp(argv[arg], "latency") == 0;
+    bool isCheck = arg < argc && std::strcmp(argv[arg], "check") == 0;
+    if (!isLatency && !isCheck)
+    {
+        std::cerr << "Usage: " << argv[0] << " [--unix PATH | --tcp PORT] latency [requests]" << std::endl;
+        std::cerr << "       " << argv[0] << " [--unix PATH | --tcp PORT] check" << std::endl;
+        return 1;
+    }
+
+    int fd = port > 0 && port <= 65535 ? connectTcp(static_cast<std::uint16_t>(port)) : connectUnix(path);
+    if (fd < 0)
+    {
+        std::cerr << "Cannot connect to the server" << std::endl;
+        return 1;
+    }
+    int status;
+    if (isLatency)
+    {
+        int requests = arg + 1 < argc ? std::atoi(argv[arg + 1]) : 100000;
+        status = latency(fd, requests > 0 ? requests : 1);
+    }
+    else
+    {
+        status = check(fd);
+    }
+    close(fd);
+    return status;
+}
@@ -0,0 +1,11 @@
+# Builds, verifies and samples board corpora on several threads.
+TEMPLATE = app
+TARGET = corpustool
+CONFIG += console c++17 release thread
+CONFIG -= app_bundle qt
+
+include(../../engine.pri)
+include(../../corpus.pri)
+
+SOURCES += \
+    main.cpp
@@ -0,0 +1,256 @@
+/*
+ * Author: Martin Nguyen
+ * Description: Builds, verifies and samples board corpora, using several threads
+ * Date: 10/19/2026
+ */
+
+#include "CorpusReader.h"
+#include "CorpusWriter.h"
+#include "GameEngine.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace {
+
+// Boards each thread encodes per round, and boards per segment file
+constexpr std::uint64_t BLOCK_BOARDS = 4096;
+constexpr std::uint64_t SEGMENT_BOARDS = 1u << 24;
+
+using Clock = std::chrono::steady_clock;
+
+/*
+ * Function: build
+ * Description: Adds a segment (or several) of seeded boards to a corpus. Board k uses seed
+ *              firstSeed + k, so it's the board a GameEngine with that seed would play.
+ *              Threads encode blocks of boards in parallel; the blocks are written in order.
+ * Parameters: directory - The corpus, width/height/mines - Board size, count - Boards to add,
+ *             threads - Encoding threads, firstSeed - Seed of the first board
+ * Returns: Process exit status
+ */
+int build(const std::string &directory, int width, int height, int mines, std::uint64_t count, int threads,
+          std::uint32_t firstSeed)
+{
+    if (count == 0)
+    {
+        std::cerr << "No boards to add" << std::endl;
+        return 1;
+    }
+    CorpusWriter writer;
+    Clock::time_point start = Clock::now();
+    std::vector<std::vector<std::uint8_t>> blocks(static_cast<size_t>(threads));
+    std::uint64_t firstId = 0;
+    std::uint64_t bytes = 0;
+    for (std::uint64_t done = 0; done < count;)
+    {
+        if (!writer.isOpen())
+        {
+            if (!writer.open(directory, width, height, mines))
+            {
+                std::cerr << "Cannot add a segment to " << directory << std::endl;
+                return 1;
+            }
+            if (done == 0)
+                firstId = writer.getFirstId();
+        }
+        std::uint64_t round = std::min({ count - done, BLOCK_BOARDS * threads, SEGMENT_BOARDS - writer.getCount() });
+
+        std::vector<std::thread> workers;
+        for (int t = 0; t < threads; ++t)
+        {
+            workers.emplace_back([&, t]() {
+                std::vector<std::uint8_t> &block = blocks[static_cast<size_t>(t)];
+                block.clear();
+                std::uint64_t begin = std::min(round, BLOCK_BOARDS * t);
+                std::uint64_t end = std::min(round, begin + BLOCK_BOARDS);
+                for (std::uint64_t k = done + begin; k < done + end; ++k)
+                    writer.getCodec().encode(GameEngine::generateMineLayout(width * height, mines,
+                                                                            static_cast<std::uint32_t>(firstSeed + k)), block);
+            });
+        }
+        for (std::thread &worker : workers)
+            worker.join();
+        for (const std::vector<std::uint8_t> &block : blocks)
+        {
+            if (!writer.addEncoded(block.data(), block.size()))
+            {
+                std::cerr << "Cannot write to " << directory << std::endl;
+                return 1;
+            }
+            bytes += block.size();
+        }
+
+        done += round;
+        if (writer.getCount() == SEGMENT_BOARDS && !writer.close())
+        {
+            std::cerr << "Cannot finish a segment in " << directory << std::endl;
+            return 1;
+        }
+    }
+    if (writer.isOpen() && !writer.close())
+    {
+        std::cerr << "Cannot finish a segment in " << directory << std::endl;
+        return 1;
+    }
+
+    double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    std::cout << "Added boards " << firstId << " to " << firstId + count - 1 << " (" << width << "x" << height
+              << ", " << mines << " mines): " << static_cast<double>(bytes) / static_cast<double>(count)
+              << " bytes/board, " << static_cast<double>(count) / seconds << " boards/s" << std::endl;
+    return 0;
+}
+
+/*
+ * Function: verify
+ * Description: Decodes every board of every segment and checks each segment's checksum
+ * Parameters: directory - The corpus, threads - Checking threads
+ * Returns: Process exit status (1 if anything is damaged)
+ */
+int verify(const std::string &directory, int threads)
+{
+    CorpusReader reader;
+    if (!reader.open(directory))
+    {
+        std::cerr << "Cannot read " << directory << std::endl;
+        return 1;
+    }
+
+    Clock::time_point start = Clock::now();
+    int damagedSegments = 0;
+    for (size_t s = 0; s < reader.getSegmentCount(); ++s)
+    {
+        const CorpusReader::SegmentInfo &info = reader.getSegmentInfo(s);
+        std::atomic<std::uint64_t> checksum(0);
+        std::atomic<std::uint64_t> bad(0);
+        std::vector<std::thread> workers;
+        for (int t = 0; t < threads; ++t)
+        {
+            workers.emplace_back([&, t]() {
+                std::vector<int> layout;
+                std::uint64_t sum = 0;
+                std::uint64_t failed = 0;
+                for (std::uint64_t k = static_cast<std::uint64_t>(t); k < info.count; k += threads)
+                {
+                    std::uint64_t hash = 0;
+                    if (!reader.getLayout(info.firstId + k, layout, &hash) ||
+                        static_cast<int>(layout.size()) != info.mines)
+                        ++failed;
+                    sum += hash;
+                }
+                checksum += sum;
+                bad += failed;
+            });
+        }
+        for (std::thread &worker : workers)
+            worker.join();
+
+        if (bad != 0 || checksum != info.checksum)
+        {
+            ++damagedSegments;
+            std::cerr << "Segment at id " << info.firstId << ": " << bad << " unreadable boards"
+                      << (checksum != info.checksum ? ", checksum mismatch" : "") << std::endl;
+        }
+    }
+
+    double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    std::cout << "Checked " << reader.getBoardCount() << " boards in " << reader.getSegmentCount() << " segments in "
+              << seconds << " s: " << (damagedSegments == 0 ? "ok" : "DAMAGED") << std::endl;
+    return damagedSegments == 0 ? 0 : 1;
+}
+
+/*
+ * Function: sample
+ * Description: Loads random boards into engines and reports the time per load
+ * Parameters: directory - The corpus, count - Boards to load, threads - Loading threads
+ * Returns: Process exit status
+ */
+int sample(const std::string &directory, std::uint64_t count, int threads)
+{
+    CorpusReader reader;
+    if (!reader.open(directory) || reader.getBoardCount() == 0)
+    {
+        std::cerr << "No boards in " << directory << std::endl;
+        return 1;
+    }
+    const CorpusReader::SegmentInfo &last = reader.getSegmentInfo(reader.getSegmentCount() - 1);
+    const std::uint64_t firstId = reader.getSegmentInfo(0).firstId;
+    const std::uint64_t endId = last.firstId + last.count;
+
+    std::atomic<std::uint64_t> loaded(0);
+    std::atomic<std::uint64_t> nanoseconds(0);
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; ++t)
+    {
+        workers.emplace_back([&, t]() {
+            GameEngine engine;
+            std::mt19937_64 rng(static_cast<std::uint64_t>(t) + 1);
+            std::uint64_t done = 0;
+            Clock::duration spent(0);
+            for (std::uint64_t k = static_cast<std::uint64_t>(t); k < count; k += threads)
+            {
+                std::uint64_t id = firstId + rng() % (endId - firstId);
+                Clock::time_point start = Clock::now();
+                bool ok = reader.loadInto(id, engine);
+                spent += Clock::now() - start;
+                if (!ok)
+                    continue; // a gap between segments
+                ++done;
+                if (t == 0 && k < 5)
+                    std::cout << "board " << id << ": " << engine.getWidth() << "x" << engine.getHeight() << ", "
+                              << engine.getMines() << " mines, 3BV " << engine.getThreeBV() << std::endl;
+            }
+            loaded += done;
+            nanoseconds += static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(spent).count());
+        });
+    }
+    for (std::thread &worker : workers)
+        worker.join();
+
+    std::cout << "Loaded " << loaded << " random boards of " << reader.getBoardCount() << ": "
+              << static_cast<double>(nanoseconds) / 1000.0 / static_cast<double>(std::max<std::uint64_t>(loaded, 1))
+              << " us/board per thread" << std::endl;
+    return 0;
+}
+
+} // namespace
+
+/*
+ * Function: main
+ * Description: Usage: corpustool build DIR WIDTHxHEIGHT MINES COUNT [threads] [first seed]
+ *                     corpustool verify DIR [threads]
+ *                     corpustool sample DIR COUNT [threads]
+ */
+int main(int argc, char *argv[])
+{
+    int hardware = static_cast<int>(std::thread::hardware_concurrency());
+    auto threadsArg = [&](int index) {
+        int threads = argc > index ? std::atoi(argv[index]) : hardware;
+        return threads > 0 ? threads : 1;
+    };
+
+    int width = 0;
+    int height = 0;
+    if (argc >= 6 && std::strcmp(argv[1], "build") == 0 && std::sscanf(argv[3], "%dx%d", &width, &height) == 2)
+    {
+        std::uint32_t firstSeed = argc > 7 ? static_cast<std::uint32_t>(std::strtoul(argv[7], nullptr, 10)) : 1;
+        return build(argv[2], width, height, std::atoi(argv[4]), std::strtoull(argv[5], nullptr, 10), threadsArg(6),
+                     firstSeed);
+    }
+    if (argc >= 3 && std::strcmp(argv[1], "verify") == 0)
+        return verify(argv[2], threadsArg(3));
+    if (argc >= 4 && std::strcmp(argv[1], "sample") == 0)
+        return sample(argv[2], std::strtoull(argv[3], nullptr, 10), threadsArg(4));
+
+    std::cerr << "Usage: " << argv[0] << " build DIR WIDTHxHEIGHT MINES COUNT [threads] [first seed]" << std::endl;
+    std::cerr << "       " << argv[0] << " verify DIR [threads]" << std::endl;
+    std::cerr << "       " << argv[0] << " sample DIR COUNT [threads]" << std::endl;
+    return 1;
+}
@@ -0,0 +1,93 @@
+/*
+ * Author: Martin Nguyen
+ * Description: Generates the solver's pattern table and measures how often it hits
+ * Date: 10/19/2026
+ */
+
+#include "PatternDatabase.h"
+#include "Solver.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+
+/*
+ * Function: main
+ * Description: Usage: patterngen [output file] [training games] [test games]
+ *              Builds the table from the training games, saves it, then plays fresh test games
+ *              with and without it to report the hit rate, the time saved and any disagreement.
+ */
+int main(int argc, char *argv[])
+{
+    using Clock = std::chrono::steady_clock;
+    const std::string path = argc > 1 ? argv[1] : "patterns.bin";
+    const int trainingGames = argc > 2 ? std::atoi(argv[2]) : PatternDatabase::DEFAULT_GAMES;
+    const int testGames = argc > 3 ? std::atoi(argv[3]) : 300;
+
+    PatternDatabase patterns;
+    Clock::time_point start = Clock::now();
+    patterns.generate(trainingGames, 1);
+    double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    std::cout << "Generated " << patterns.size() << " patterns from " << trainingGames << " games in "
+              << seconds << " s" << std::endl;
+    if (!patterns.save(path))
+    {
+        std::cerr << "Cannot write " << path << std::endl;
+        return 1;
+    }
+
+    // Play fresh games, asking both solvers at every step
+    Solver withTable(&patterns);
+    Solver withoutTable;
+    double tableSeconds = 0;
+    double plainSeconds = 0;
+    int mismatches = 0;
+    std::mt19937 rng(12345);
+    for (int game = 0; game < testGames; ++game)
+    {
+        GameEngine engine(30, 16, 99);
+        engine.setSeed(rng());
+        engine.reveal(8, 15);
+        while (engine.getStatus() == GameEngine::Status::Playing)
+        {
+            std::vector<int> safe, mines, plainSafe, plainMines;
+            start = Clock::now();
+            withTable.findForcedMoves(engine, safe, mines);
+            tableSeconds += std::chrono::duration<double>(Clock::now() - start).count();
+            start = Clock::now();
+            withoutTable.findForcedMoves(engine, plainSafe, plainMines);
+            plainSeconds += std::chrono::duration<double>(Clock::now() - start).count();
+
+            std::sort(safe.begin(), safe.end());
+            std::sort(plainSafe.begin(), plainSafe.end());
+            std::sort(mines.begin(), mines.end());
+            std::sort(plainMines.begin(), plainMines.end());
+            if (safe != plainSafe || mines != plainMines)
+                ++mismatches;
+
+            if (safe.empty())
+            {
+                int index;
+                do
+                    index = static_cast<int>(rng() % (30 * 16));
+                while (engine.getSpace(index / 30, index % 30).getIsRevealed());
+                safe.push_back(index);
+            }
+            for (int index : safe)
+                engine.reveal(index / 30, index % 30);
+        }
+    }
+
+    std::cout << "Hit rate:      " << patterns.getHitRate() * 100 << "% of " << patterns.getProbes() << " probes"
+              << std::endl;
+    std::cout << "With table:    " << tableSeconds * 1000 << " ms" << std::endl;
+    std::cout << "Enumeration:   " << plainSeconds * 1000 << " ms" << std::endl;
+    if (mismatches != 0)
+    {
+        std::cerr << mismatches << " positions where the table and enumeration disagree" << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,11 @@
+# Generates the pattern table used by the solver and reports its hit rate.
+TEMPLATE = app
+TARGET = patterngen
+CONFIG += console c++17
+CONFIG -= app_bundle qt
+
+include(../../engine.pri)
+include(../../solver.pri)
+
+SOURCES += \
+    main.cpp
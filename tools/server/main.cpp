@@ -0,0 +1,74 @@
+/*
+ * Author: Martin Nguyen
+ * Description: Main file for the headless Minesweeper game server
+ * Date: 10/19/2026
+ */
+
+#include "GameServer.h"
+
+#include <csignal>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+namespace {
+
+GameServer *activeServer = nullptr;
+
+void handleSignal(int)
+{
+    if (activeServer)
+        activeServer->stop();
+}
+
+} // namespace
+
+/*
+ * Function: main
+ * Description: Starts the server. Usage: minesweeperserver [--unix PATH] [--tcp PORT] [--analysis]
+ *              (--analysis allows undo, redo and what-if requests)
+ *              (defaults to a Unix socket at /tmp/minesweeper.sock)
+ */
+int main(int argc, char *argv[])
+{
+    GameServer server;
+    bool listening = false;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        if (std::strcmp(argv[i], "--unix") == 0 && i + 1 < argc)
+        {
+            if (!server.listenUnix(argv[++i]))
+                return 1;
+            listening = true;
+        }
+        else if (std::strcmp(argv[i], "--tcp") == 0 && i + 1 < argc)
+        {
+            int port = std::atoi(argv[++i]);
+            if (port <= 0 || port > 65535 || !server.listenTcp(static_cast<std::uint16_t>(port)))
+                return 1;
+            listening = true;
+        }
+        else if (std::strcmp(argv[i], "--analysis") == 0)
+        {
+            server.setAnalysis(true);
+        }
+        else
+        {
+            std::cerr << "Usage: " << argv[0] << " [--unix PATH] [--tcp PORT] [--analysis]" << std::endl;
+            return 1;
+        }
+    }
+    if (!listening && !server.listenUnix("/tmp/minesweeper.sock"))
+        return 1;
+
+    // Ctrl+C stops the event loop so the socket file gets cleaned up
+    activeServer = &server;
+    struct sigaction action {};
+    action.sa_handler = handleSignal;
+    sigaction(SIGINT, &action, nullptr);
+    sigaction(SIGTERM, &action, nullptr);
+
+    server.run();
+    return 0;
+}
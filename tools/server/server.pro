@@ -0,0 +1,14 @@
+# Headless game server for bot clients (Linux only: uses epoll).
+TEMPLATE = app
+TARGET = minesweeperserver
+CONFIG += console c++17
+CONFIG -= app_bundle qt
+
+include(../../engine.pri)
+
+SOURCES += \
+    ../../GameServer.cpp \
+    main.cpp
+
+HEADERS += \
+    ../../GameServer.h
@@ -0,0 +1,185 @@
+/*
+ * Author: Martin Nguyen
+ * Description: Writes game statistics from simulated play and scans columns of statistics files
+ * Date: 10/19/2026
+ */
+
+#include "GameRecord.h"
+#include "Solver.h"
+#include "StatsReader.h"
+#include "StatsWriter.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace {
+
+/*
+ * Function: playGame
+ * Description: Plays one game: reveals every square the solver proves safe, otherwise guesses
+ * Parameters: engine - A freshly reset engine, solver - The solver, rng - Picks the guesses
+ * Returns: Number of guesses made
+ */
+int playGame(GameEngine &engine, Solver &solver, std::mt19937 &rng)
+{
+    const int width = engine.getWidth();
+    const int cells = width * engine.getHeight();
+    std::vector<int> safe, mines;
+    int guesses = 0;
+    while (engine.getStatus() == GameEngine::Status::Playing)
+    {
+        if (solver.findForcedMoves(engine, safe, mines) && !safe.empty())
+        {
+            for (int index : safe)
+                engine.reveal(index / width, index % width);
+            continue;
+        }
+        int index;
+        do
+            index = static_cast<int>(rng() % static_cast<std::uint32_t>(cells));
+        while (engine.getSpace(index / width, index % width).getIsRevealed());
+        engine.reveal(index / width, index % width);
+        ++guesses;
+    }
+    return guesses;
+}
+
+/*
+ * Function: simulate
+ * Description: Plays games on several threads, all pushing their records into one writer.
+ *              The solvers share one pattern table, loaded (or generated and saved) first.
+ * Parameters: path - Statistics file, games - Number of games, threads - Number of game threads,
+ *             patternPath - Pattern table file
+ * Returns: Process exit status
+ */
+int simulate(const std::string &path, int games, int threads, const std::string &patternPath)
+{
+    using Clock = std::chrono::steady_clock;
+    PatternDatabase patterns;
+    if (!patterns.loadOrGenerate(patternPath))
+        std::cout << "Generated " << patterns.size() << " patterns into " << patternPath << std::endl;
+
+    StatsWriter writer;
+    if (!writer.open(path))
+    {
+        std::cerr << "Cannot open " << path << " for writing" << std::endl;
+        return 1;
+    }
+
+    Clock::time_point start = Clock::now();
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; ++t)
+    {
+        workers.emplace_back([&writer, &patterns, games, threads, t]() {
+            GameEngine engine(30, 16, 99);
+            Solver solver(&patterns);
+            std::mt19937 rng(static_cast<std::uint32_t>(t + 1));
+            for (int game = t; game < games; game += threads)
+            {
+                Clock::time_point gameStart = Clock::now();
+                engine.reset();
+                int guesses = playGame(engine, solver, rng);
+                auto micros = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - gameStart);
+                writer.push(GameRecord::fromEngine(engine, guesses, static_cast<std::uint64_t>(micros.count())));
+            }
+        });
+    }
+    for (std::thread &worker : workers)
+        worker.join();
+    writer.close();
+
+    double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    std::cout << "Wrote " << writer.getRowsWritten() << " games in " << seconds << " s on " << threads
+              << " threads" << std::endl;
+    std::cout << "Pattern table hit rate: " << patterns.getHitRate() * 100 << "% of " << patterns.getProbes()
+              << " probes" << std::endl;
+    return writer.hasFailed() ? 1 : 0;
+}
+
+/*
+ * Function: scan
+ * Description: Reads one column and prints its count, min, max and mean
+ * Parameters: path - Statistics file, name - Column name, min/max - Only chunks that may hold
+ *             values in this range are read, and only those values are counted
+ * Returns: Process exit status
+ */
+int scan(const std::string &path, const std::string &name, std::uint64_t min, std::uint64_t max)
+{
+    using Clock = std::chrono::steady_clock;
+    int column = GameRecord::findColumn(name);
+    if (column < 0)
+    {
+        std::cerr << "No column named " << name << std::endl;
+        return 1;
+    }
+    StatsReader reader;
+    if (!reader.open(path))
+    {
+        std::cerr << "Cannot read " << path << std::endl;
+        return 1;
+    }
+
+    Clock::time_point start = Clock::now();
+    std::uint64_t count = 0;
+    std::uint64_t low = UINT64_MAX;
+    std::uint64_t high = 0;
+    double sum = 0;
+    std::uint64_t visited = reader.scanColumn(column, [&](const std::uint64_t *values, size_t rows) {
+        for (size_t i = 0; i < rows; ++i)
+        {
+            std::uint64_t value = values[i];
+            if (value < min || value > max)
+                continue;
+            ++count;
+            low = value < low ? value : low;
+            high = value > high ? value : high;
+            sum += static_cast<double>(value);
+        }
+    }, min, max);
+    double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+    std::cout << name << ": " << count << " rows";
+    if (count != 0)
+        std::cout << ", min " << low << ", max " << high << ", mean " << sum / static_cast<double>(count);
+    std::cout << std::endl;
+    std::cout << "Read " << visited << " of " << reader.getRowCount() << " rows (" << reader.getChunkCount()
+              << " chunks) in " << seconds * 1000 << " ms" << std::endl;
+    return 0;
+}
+
+} // namespace
+
+/*
+ * Function: main
+ * Description: Usage: statstool simulate FILE [games] [threads] [pattern table]
+ *                     statstool scan FILE COLUMN [min max]
+ */
+int main(int argc, char *argv[])
+{
+    if (argc >= 3 && std::strcmp(argv[1], "simulate") == 0)
+    {
+        int games = argc > 3 ? std::atoi(argv[3]) : 10000;
+        int threads = argc > 4 ? std::atoi(argv[4]) : static_cast<int>(std::thread::hardware_concurrency());
+        std::string patternPath = argc > 5 ? argv[5] : "patterns.bin";
+        return simulate(argv[2], games, threads > 0 ? threads : 1, patternPath);
+    }
+    if (argc >= 4 && std::strcmp(argv[1], "scan") == 0)
+    {
+        std::uint64_t min = argc > 5 ? std::strtoull(argv[4], nullptr, 10) : 0;
+        std::uint64_t max = argc > 5 ? std::strtoull(argv[5], nullptr, 10) : UINT64_MAX;
+        return scan(argv[2], argv[3], min, max);
+    }
+
+    std::cerr << "Usage: " << argv[0] << " simulate FILE [games] [threads] [pattern table]" << std::endl;
+    std::cerr << "       " << argv[0] << " scan FILE COLUMN [min max]" << std::endl;
+    std::cerr << "Columns:";
+    for (int column = 0; column < GameRecord::COLUMN_COUNT; ++column)
+        std::cerr << " " << GameRecord::getColumnName(column);
+    std::cerr << std::endl;
+    return 1;
+}
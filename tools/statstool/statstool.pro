@@ -0,0 +1,16 @@
+# Statistics files: writes records from simulated games and scans columns (reader is POSIX: uses mmap).
+TEMPLATE = app
+TARGET = statstool
+CONFIG += console c++17 release
+CONFIG -= app_bundle qt
+
+include(../../engine.pri)
+include(../../solver.pri)
+include(../../stats.pri)
+
+SOURCES += \
+    ../../StatsReader.cpp \
+    main.cpp
+
+HEADERS += \
+    ../../StatsReader.h